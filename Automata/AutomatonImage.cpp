@@ -0,0 +1,94 @@
+#include "AutomatonImage.h"
+#include "MappedFile.h"
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+AutomatonImage::AutomatonImage(const char* magic, size_t payloadSize)
+{
+	size = sizeof(Header) + Align(payloadSize);
+	auto buffer = std::make_shared<std::vector<uint64_t>>(size / sizeof(uint64_t), 0);
+	data = reinterpret_cast<const char*>(buffer->data());
+	owner = buffer;
+
+	Header* header = reinterpret_cast<Header*>(const_cast<char*>(data));
+	std::memcpy(header->magic, magic, sizeof(header->magic));
+	header->version = version;
+	header->byteOrder = byteOrder;
+	header->payloadSize = size - sizeof(Header);
+}
+
+// Called once the payload is written.
+void AutomatonImage::Seal()
+{
+	Header* header = reinterpret_cast<Header*>(const_cast<char*>(data));
+	header->checksum = Checksum(GetPayload(), GetPayloadSize());
+}
+
+bool AutomatonImage::Save(const std::string& fileName) const
+{
+	std::ofstream out(fileName, std::ios::binary);
+	out.write(data, size);
+	return static_cast<bool>(out);
+}
+
+// The payload is used in place; verify also checks the checksum, which reads the whole file.
+bool AutomatonImage::Load(const std::string& fileName, const char* magic, bool verify)
+{
+	auto file = std::make_shared<MappedFile>(fileName);
+	if (!file->IsOpen() || file->GetSize() < sizeof(Header))
+		return false;
+
+	const Header* header = reinterpret_cast<const Header*>(file->GetData());
+	if (std::memcmp(header->magic, magic, sizeof(header->magic)) != 0 ||
+		header->version != version ||
+		header->byteOrder != byteOrder ||
+		header->payloadSize != file->GetSize() - sizeof(Header))
+		return false;
+
+	if (verify && header->checksum != Checksum(file->GetData() + sizeof(Header), header->payloadSize))
+		return false;
+
+	data = file->GetData();
+	size = file->GetSize();
+	owner = file;
+	return true;
+}
+
+char* AutomatonImage::GetPayload()
+{
+	return const_cast<char*>(data) + sizeof(Header);
+}
+
+const char* AutomatonImage::GetPayload() const
+{
+	return data + sizeof(Header);
+}
+
+size_t AutomatonImage::GetPayloadSize() const
+{
+	return size - sizeof(Header);
+}
+
+size_t AutomatonImage::Align(size_t size)
+{
+	return (size + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t);
+}
+
+// FNV-1a over 64-bit words
+uint64_t AutomatonImage::Checksum(const char* data, size_t size)
+{
+	uint64_t hash = 14695981039346656037ull;
+	size_t index = 0;
+	for (; index + sizeof(uint64_t) <= size; index += sizeof(uint64_t))
+	{
+		uint64_t word;
+		std::memcpy(&word, data + index, sizeof(word));
+		hash = (hash ^ word) * 1099511628211ull;
+	}
+
+	for (; index < size; ++index)
+		hash = (hash ^ static_cast<unsigned char>(data[index])) * 1099511628211ull;
+
+	return hash;
+}
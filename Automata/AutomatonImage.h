@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// An automaton in its binary file layout: a header followed by a payload whose
+// sections each automaton class lays out itself. The memory is either built in
+// place or mapped read-only from a file, and copies of an image share it.
+class AutomatonImage
+{
+public:
+	static constexpr uint32_t version = 1;
+	static constexpr uint32_t byteOrder = 0x01020304;
+
+	struct Header
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t byteOrder;
+		uint64_t payloadSize;
+		uint64_t checksum;
+	};
+
+public:
+	AutomatonImage() = default;
+	AutomatonImage(const char* magic, size_t payloadSize);
+
+	void Seal();
+	bool Save(const std::string&) const;
+	bool Load(const std::string&, const char* magic, bool verify);
+
+	char* GetPayload();
+	const char* GetPayload() const;
+	size_t GetPayloadSize() const;
+
+	static size_t Align(size_t);
+	static uint64_t Checksum(const char*, size_t);
+
+private:
+	std::shared_ptr<const void> owner;
+	const char* data = nullptr;
+	size_t size = 0;
+};
@@ -0,0 +1,151 @@
+#include "BitParallelNFA.h"
+#include <bit>
+#include <stdexcept>
+
+BitParallelNFA::BitParallelNFA(const NFA& NFA) :
+	BitParallelNFA(CompiledNFA(NFA))
+{
+}
+
+BitParallelNFA::BitParallelNFA(const CompiledNFA& compiledNFA)
+{
+	if (!Supports(compiledNFA))
+		throw std::length_error("BitParallelNFA: more than 512 states");
+
+	numberOfStates = compiledNFA.GetNumberOfStates();
+	numberOfClasses = compiledNFA.GetNumberOfClasses();
+	numberOfWords = numberOfStates > wordBits ? (numberOfStates + wordBits - 1) / wordBits : 1;
+
+	successors.assign(numberOfClasses * numberOfStates * numberOfWords, 0);
+	std::vector<bool> built(numberOfClasses, false);
+	for (size_t byte = 0; byte < 256; ++byte)
+	{
+		char character = static_cast<char>(byte);
+		CompiledNFA::SymbolClass symbolClass = compiledNFA.GetSymbolClass(character);
+		symbolClasses[byte] = symbolClass;
+		if (built[symbolClass])
+			continue;
+		built[symbolClass] = true;
+
+		for (size_t state = 0; state < numberOfStates; ++state)
+		{
+			Word* mask = &successors[(symbolClass * numberOfStates + state) * numberOfWords];
+			CompiledNFA::Targets transition = compiledNFA.GetTransitions(static_cast<CompiledNFA::StateId>(state), character);
+			for (const CompiledNFA::StateId* nextState = transition.first; nextState != transition.second; ++nextState)
+				mask[*nextState / wordBits] |= Word(1) << (*nextState % wordBits);
+		}
+	}
+
+	initialStates.assign(numberOfWords, 0);
+	finalStates.assign(numberOfWords, 0);
+	if (numberOfStates != 0)
+		initialStates[compiledNFA.GetInitialState() / wordBits] |= Word(1) << (compiledNFA.GetInitialState() % wordBits);
+	for (size_t state = 0; state < numberOfStates; ++state)
+		if (compiledNFA.IsFinal(static_cast<CompiledNFA::StateId>(state)))
+			finalStates[state / wordBits] |= Word(1) << (state % wordBits);
+
+	if (numberOfWords != 1)
+		return;
+
+	// The successors of a byte of the state set are those of its lowest bit and of the
+	// byte without it, which is smaller and already filled in.
+	byteSuccessors.assign(numberOfClasses * 8 * 256, 0);
+	for (size_t symbolClass = 0; symbolClass < numberOfClasses; ++symbolClass)
+		for (size_t byte = 0; byte < 8; ++byte)
+		{
+			Word* table = &byteSuccessors[(symbolClass * 8 + byte) * 256];
+			for (size_t value = 1; value < 256; ++value)
+			{
+				size_t state = byte * 8 + std::countr_zero(static_cast<unsigned>(value));
+				Word mask = state < numberOfStates ? successors[symbolClass * numberOfStates + state] : 0;
+				table[value] = table[value & (value - 1)] | mask;
+			}
+		}
+}
+
+bool BitParallelNFA::Supports(const NFA& NFA)
+{
+	return NFA.GetStates().size() <= maxStates;
+}
+
+bool BitParallelNFA::Supports(const CompiledNFA& compiledNFA)
+{
+	return compiledNFA.GetNumberOfStates() <= maxStates;
+}
+
+// O(l), l = word.length(), for a fixed number of states
+bool BitParallelNFA::Accepts(const std::string& word) const
+{
+	switch (numberOfWords)
+	{
+	case 1: return AcceptsByBytes(word);
+	case 2: return Accepts<2>(word);
+	case 3: return Accepts<3>(word);
+	case 4: return Accepts<4>(word);
+	case 5: return Accepts<5>(word);
+	case 6: return Accepts<6>(word);
+	case 7: return Accepts<7>(word);
+	default: return Accepts<8>(word);
+	}
+}
+
+template<size_t Words>
+bool BitParallelNFA::Accepts(const std::string& word) const
+{
+	std::array<Word, Words> currStates, nextStates;
+	for (size_t index = 0; index < Words; ++index)
+		currStates[index] = initialStates[index];
+
+	for (const auto& character : word)
+	{
+		const Word* masks = &successors[symbolClasses[static_cast<unsigned char>(character)] * numberOfStates * Words];
+		nextStates.fill(0);
+		for (size_t index = 0; index < Words; ++index)
+			for (Word active = currStates[index]; active; active &= active - 1)
+			{
+				const Word* mask = masks + (index * wordBits + std::countr_zero(active)) * Words;
+				for (size_t part = 0; part < Words; ++part)
+					nextStates[part] |= mask[part];
+			}
+
+		Word any = 0;
+		for (size_t index = 0; index < Words; ++index)
+			any |= nextStates[index];
+		if (!any)
+			return false;
+		currStates = nextStates;
+	}
+
+	for (size_t index = 0; index < Words; ++index)
+		if (currStates[index] & finalStates[index])
+			return true;
+	return false;
+}
+
+bool BitParallelNFA::AcceptsByBytes(const std::string& word) const
+{
+	Word currStates = initialStates[0];
+	for (const auto& character : word)
+	{
+		const Word* tables = &byteSuccessors[symbolClasses[static_cast<unsigned char>(character)] * 8 * 256];
+		Word nextStates = 0;
+		for (size_t byte = 0; byte < 8; ++byte)
+			nextStates |= tables[byte * 256 + ((currStates >> (byte * 8)) & 0xFF)];
+
+		if (!nextStates)
+			return false;
+		currStates = nextStates;
+	}
+
+	return (currStates & finalStates[0]) != 0;
+}
+
+size_t BitParallelNFA::GetNumberOfStates() const
+{
+	return numberOfStates;
+}
+
+size_t BitParallelNFA::GetNumberOfWords() const
+{
+	return numberOfWords;
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include "CompiledNFA.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Simulates an NFA of at most maxStates states with the set of active states kept in
+// machine words. For every symbol class the successors of each state are precomputed as
+// a mask, so a step ORs the masks of the active states; with up to 64 states the masks are
+// further combined per byte of the state set, and a step is 8 table lookups.
+class BitParallelNFA
+{
+public:
+	static constexpr size_t maxStates = 512;
+
+public:
+	explicit BitParallelNFA(const NFA&);
+	explicit BitParallelNFA(const CompiledNFA&);
+
+	static bool Supports(const NFA&);
+	static bool Supports(const CompiledNFA&);
+
+	bool Accepts(const std::string&) const;
+
+	size_t GetNumberOfStates() const;
+	size_t GetNumberOfWords() const;
+
+private:
+	using Word = uint64_t;
+	static constexpr size_t wordBits = 64;
+
+	template<size_t Words>
+	bool Accepts(const std::string&) const;
+	bool AcceptsByBytes(const std::string&) const;
+
+private:
+	std::array<uint8_t, 256> symbolClasses = {};
+	size_t numberOfStates = 0;
+	size_t numberOfClasses = 1;
+	size_t numberOfWords = 1;
+	// successors[(symbolClass * numberOfStates + state) * numberOfWords + word]
+	std::vector<Word> successors;
+	// byteSuccessors[(symbolClass * 8 + byte) * 256 + value], only with one word
+	std::vector<Word> byteSuccessors;
+	std::vector<Word> initialStates;
+	std::vector<Word> finalStates;
+};
@@ -0,0 +1,509 @@
+#include "CompiledDFA.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <queue>
+
+namespace
+{
+	struct Counts
+	{
+		uint32_t numberOfStates;
+		uint32_t numberOfClasses;
+		uint32_t initialState;
+		uint32_t firstLiveState;
+		uint64_t namesSize;
+	};
+
+	// Offsets of the sections of the payload, each of them 8-byte aligned:
+	// counts, byte classes, transition matrix, final flags, name offsets, names.
+	struct Layout
+	{
+		size_t symbolClasses, transitions, finalStates, nameOffsets, names, size;
+
+		Layout(size_t numberOfStates, size_t numberOfClasses, size_t namesSize)
+		{
+			symbolClasses = AutomatonImage::Align(sizeof(Counts));
+			transitions = symbolClasses + AutomatonImage::Align(256);
+			finalStates = transitions + AutomatonImage::Align(numberOfStates * numberOfClasses * sizeof(uint32_t));
+			nameOffsets = finalStates + AutomatonImage::Align(numberOfStates);
+			names = nameOffsets + AutomatonImage::Align((numberOfStates + 1) * sizeof(uint32_t));
+			size = names + namesSize;
+		}
+	};
+}
+
+CompiledDFA::CompiledDFA() :
+	CompiledDFA(DFA())
+{
+}
+
+CompiledDFA::CompiledDFA(const DFA& DFA)
+{
+	// Indexed by the ids of the DFA; transitions from or to names that were never declared as states are left out.
+	size_t numberOfIds = 0;
+	for (const auto& state : DFA.GetStates())
+		numberOfIds = std::max<size_t>(numberOfIds, state + 1);
+
+	std::vector<std::vector<DFA::StateId>> predecessors(numberOfIds);
+	for (const auto& transition : DFA.GetTransitionTable())
+		if (DFA.GetStates().Contains(transition.first.first) && DFA.GetStates().Contains(transition.second))
+			predecessors[transition.second].push_back(transition.first.first);
+
+	std::vector<bool> liveStates(numberOfIds, false);
+	std::queue<DFA::StateId> queue;
+	for (const auto& finalState : DFA.GetFinalStates())
+		if (DFA.GetStates().Contains(finalState) && !liveStates[finalState])
+		{
+			liveStates[finalState] = true;
+			queue.push(finalState);
+		}
+
+	while (!queue.empty())
+	{
+		DFA::StateId currState = queue.front();
+		queue.pop();
+
+		for (const auto& state : predecessors[currState])
+			if (!liveStates[state])
+			{
+				liveStates[state] = true;
+				queue.push(state);
+			}
+	}
+
+	// States from which no final state is reachable get the ids right after the
+	// dead state, so checking whether a match is still possible is one comparison.
+	std::vector<StateId> stateIds(numberOfIds, deadState);
+	std::vector<DFA::State> stateNames(1);
+	for (const auto& state : DFA.GetStates())
+		if (!liveStates[state])
+		{
+			stateIds[state] = static_cast<StateId>(stateNames.size());
+			stateNames.push_back(DFA.GetStateName(state));
+		}
+
+	StateId firstLive = static_cast<StateId>(stateNames.size());
+	for (const auto& state : DFA.GetStates())
+		if (liveStates[state])
+		{
+			stateIds[state] = static_cast<StateId>(stateNames.size());
+			stateNames.push_back(DFA.GetStateName(state));
+		}
+
+	StateId initial = deadState;
+	if (DFA.GetStates().Contains(DFA.GetInitialState()))
+		initial = stateIds[DFA.GetInitialState()];
+
+	std::vector<std::vector<StateId>> symbolColumns(256);
+	for (const auto& transition : DFA.GetTransitionTable())
+	{
+		if (!DFA.GetStates().Contains(transition.first.first) || !DFA.GetStates().Contains(transition.second))
+			continue;
+
+		auto& column = symbolColumns[static_cast<unsigned char>(transition.first.second)];
+		if (column.empty())
+			column.resize(stateNames.size(), deadState);
+		column[stateIds[transition.first.first]] = stateIds[transition.second];
+	}
+
+	// Bytes whose columns in the transition table are identical share a class,
+	// so the matrix is only as wide as the number of distinct behaviours.
+	std::map<std::vector<StateId>, SymbolClass> classes;
+	std::vector<std::vector<StateId>> columns;
+	SymbolClass byteClasses[256];
+	for (size_t byte = 0; byte < 256; ++byte)
+	{
+		std::vector<StateId> column(stateNames.size(), deadState);
+		if (DFA.GetSymbols().find(static_cast<DFA::Symbol>(byte)) != DFA.GetSymbols().end() && !symbolColumns[byte].empty())
+			column = std::move(symbolColumns[byte]);
+
+		const auto& it = classes.insert(std::make_pair(column, static_cast<SymbolClass>(columns.size())));
+		if (it.second)
+			columns.push_back(std::move(column));
+		byteClasses[byte] = it.first->second;
+	}
+
+	size_t namesSize = 0;
+	for (const auto& name : stateNames)
+		namesSize += name.size();
+
+	Layout layout(stateNames.size(), columns.size(), namesSize);
+	AutomatonImage built(magic, layout.size);
+	char* payload = built.GetPayload();
+
+	Counts* counts = reinterpret_cast<Counts*>(payload);
+	counts->numberOfStates = static_cast<uint32_t>(stateNames.size());
+	counts->numberOfClasses = static_cast<uint32_t>(columns.size());
+	counts->initialState = initial;
+	counts->firstLiveState = firstLive;
+	counts->namesSize = namesSize;
+
+	std::memcpy(payload + layout.symbolClasses, byteClasses, sizeof(byteClasses));
+
+	StateId* matrix = reinterpret_cast<StateId*>(payload + layout.transitions);
+	for (size_t state = 0; state < stateNames.size(); ++state)
+		for (size_t symbolClass = 0; symbolClass < columns.size(); ++symbolClass)
+			matrix[state * columns.size() + symbolClass] = columns[symbolClass][state];
+
+	uint8_t* finals = reinterpret_cast<uint8_t*>(payload + layout.finalStates);
+	for (const auto& finalState : DFA.GetFinalStates())
+		if (DFA.GetStates().Contains(finalState))
+			finals[stateIds[finalState]] = 1;
+
+	uint32_t* offsets = reinterpret_cast<uint32_t*>(payload + layout.nameOffsets);
+	char* text = payload + layout.names;
+	offsets[0] = 0;
+	for (size_t state = 0; state < stateNames.size(); ++state)
+	{
+		std::memcpy(text + offsets[state], stateNames[state].data(), stateNames[state].size());
+		offsets[state + 1] = offsets[state] + static_cast<uint32_t>(stateNames[state].size());
+	}
+
+	built.Seal();
+	Attach(built, false);
+}
+
+bool CompiledDFA::Save(const std::string& fileName) const
+{
+	return image.Save(fileName);
+}
+
+// The tables are used where they are mapped, so loading does not depend on the size of the
+// automaton unless verify is set, in which case the checksum and every state id are checked.
+// On failure the automaton is left as it was.
+bool CompiledDFA::Load(const std::string& fileName, bool verify)
+{
+	AutomatonImage loaded;
+	if (!loaded.Load(fileName, magic, verify))
+		return false;
+	return Attach(loaded, verify);
+}
+
+bool CompiledDFA::Attach(const AutomatonImage& source, bool verify)
+{
+	const char* payload = source.GetPayload();
+	if (source.GetPayloadSize() < sizeof(Counts))
+		return false;
+
+	const Counts* counts = reinterpret_cast<const Counts*>(payload);
+	if (counts->numberOfStates == 0 || counts->numberOfClasses == 0 || counts->numberOfClasses > 256 ||
+		counts->initialState >= counts->numberOfStates || counts->firstLiveState == 0 ||
+		counts->firstLiveState > counts->numberOfStates)
+		return false;
+
+	// The other sections are bounded by the 32-bit counts, but the names could make the layout overflow.
+	if (counts->namesSize > source.GetPayloadSize())
+		return false;
+	Layout layout(counts->numberOfStates, counts->numberOfClasses, counts->namesSize);
+	if (layout.size > source.GetPayloadSize())
+		return false;
+
+	const SymbolClass* byteClasses = reinterpret_cast<const SymbolClass*>(payload + layout.symbolClasses);
+	const StateId* matrix = reinterpret_cast<const StateId*>(payload + layout.transitions);
+	const uint32_t* offsets = reinterpret_cast<const uint32_t*>(payload + layout.nameOffsets);
+	if (verify)
+	{
+		for (size_t byte = 0; byte < 256; ++byte)
+			if (byteClasses[byte] >= counts->numberOfClasses)
+				return false;
+
+		for (size_t index = 0; index < size_t(counts->numberOfStates) * counts->numberOfClasses; ++index)
+			if (matrix[index] >= counts->numberOfStates)
+				return false;
+		for (size_t symbolClass = 0; symbolClass < counts->numberOfClasses; ++symbolClass)
+			if (matrix[symbolClass] != deadState)
+				return false;
+
+		for (size_t state = 0; state < counts->numberOfStates; ++state)
+			if (offsets[state] > offsets[state + 1])
+				return false;
+		if (offsets[0] != 0 || offsets[counts->numberOfStates] != counts->namesSize)
+			return false;
+	}
+
+	image = source;
+	symbolClasses = byteClasses;
+	transitions = matrix;
+	finalStates = reinterpret_cast<const uint8_t*>(payload + layout.finalStates);
+	nameOffsets = offsets;
+	names = payload + layout.names;
+	numberOfStates = counts->numberOfStates;
+	numberOfClasses = counts->numberOfClasses;
+	initialState = counts->initialState;
+	firstLiveState = counts->firstLiveState;
+	return true;
+}
+
+// O(l), l = word.length(), one table load per character
+size_t CompiledDFA::Accepts(const std::string& word) const
+{
+	return Accepts(word.data(), word.data() + word.size());
+}
+
+// Stops early once no word with the current prefix can be accepted anymore.
+const char* CompiledDFA::Run(StateId& state, const char* begin, const char* end) const
+{
+	StateId currState = state;
+	const char* character = begin;
+	while (character != end && currState >= firstLiveState)
+	{
+		currState = transitions[currState * numberOfClasses + symbolClasses[static_cast<unsigned char>(*character)]];
+		++character;
+	}
+
+	state = currState;
+	return character;
+}
+
+// Returns the end of the longest non-empty accepted prefix of [begin, end), or nullptr if there is none.
+const char* CompiledDFA::LongestMatch(const char* begin, const char* end) const
+{
+	const char* match = nullptr;
+	StateId currState = initialState;
+	for (const char* character = begin; character != end && currState >= firstLiveState; ++character)
+	{
+		currState = transitions[currState * numberOfClasses + symbolClasses[static_cast<unsigned char>(*character)]];
+		if (finalStates[currState])
+			match = character + 1;
+	}
+
+	return match;
+}
+
+size_t CompiledDFA::Accepts(const char* begin, const char* end) const
+{
+	StateId currState = initialState;
+	for (const char* character = begin; character != end; ++character)
+	{
+		currState = transitions[currState * numberOfClasses + symbolClasses[static_cast<unsigned char>(*character)]];
+		if (currState == deadState)
+			return -1;
+	}
+
+	if (currState == deadState)
+		return -1;
+	return finalStates[currState];
+}
+
+// Words are matched `lanes` at a time, so the table loads of different words overlap
+// instead of each waiting for the previous one. Words of a few characters are matched one
+// after the other: the processor already overlaps them, as the next word does not depend on
+// the last one. Longer words each take a lane and hand it to the next word when they end.
+// When the table is too large for the cache, the words in between are grouped by length,
+// and each group of `lanes` words runs in lockstep for exactly their length, with no branch
+// on where a word ends. When it is not, a table load is a cache hit, and only words of
+// cachedInterleavedLength or more gain from being interleaved.
+// Results are the same as for Accepts(word).
+void CompiledDFA::Accepts(const Word* words, size_t count, size_t* results) const
+{
+	bool cached = numberOfStates * numberOfClasses * sizeof(StateId) <= cachedTableSize;
+	const size_t minLockstepLength = cached ? cachedInterleavedLength : lockstepLength;
+	const size_t minInterleavedLength = cached ? cachedInterleavedLength : interleavedLength;
+	const size_t numberOfGroups = minInterleavedLength - minLockstepLength + 1;
+
+	// order[offsets[g]..offsets[g + 1]) are the words of length minLockstepLength + g, the
+	// last group being the words of minInterleavedLength or more.
+	size_t offsets[interleavedLength - lockstepLength + 2] = {};
+	auto getGroup = [minLockstepLength, minInterleavedLength](size_t length)
+	{
+		return std::min(length, minInterleavedLength) - minLockstepLength;
+	};
+
+	for (size_t index = 0; index < count; ++index)
+	{
+		size_t length = words[index].second - words[index].first;
+		if (length < minLockstepLength)
+			results[index] = Accepts(words[index].first, words[index].second);
+		else
+			++offsets[getGroup(length) + 1];
+	}
+	for (size_t group = 1; group <= numberOfGroups; ++group)
+		offsets[group] += offsets[group - 1];
+	if (offsets[numberOfGroups] == 0)
+		return;
+
+	std::vector<size_t> order(offsets[numberOfGroups]);
+	size_t filled[interleavedLength - lockstepLength + 1];
+	std::copy(offsets, offsets + numberOfGroups, filled);
+	for (size_t index = 0; index < count; ++index)
+	{
+		size_t length = words[index].second - words[index].first;
+		if (length >= minLockstepLength)
+			order[filled[getGroup(length)]++] = index;
+	}
+
+	for (size_t group = 0; group + 1 < numberOfGroups; ++group)
+		AcceptsInLockstep(words, order.data() + offsets[group], offsets[group + 1] - offsets[group], minLockstepLength + group, results);
+	AcceptsInterleaved(words, order.data() + offsets[numberOfGroups - 1], order.size() - offsets[numberOfGroups - 1], results);
+}
+
+size_t CompiledDFA::GetResult(StateId state) const
+{
+	if (state == deadState)
+		return -1;
+	return finalStates[state];
+}
+
+// The words, all of the given length, are run `lanes` at a time for exactly that many steps,
+// or until every word of the group is in the dead state, which only goes to itself.
+void CompiledDFA::AcceptsInLockstep(const Word* words, const size_t* order, size_t count, size_t length, size_t* results) const
+{
+	const StateId* table = transitions;
+	const SymbolClass* classes = symbolClasses;
+	const size_t width = numberOfClasses;
+
+	for (size_t first = 0; first < count; first += lanes)
+	{
+		size_t numberOfWords = std::min(lanes, count - first);
+		StateId states[lanes];
+		const char* positions[lanes];
+		for (size_t lane = 0; lane < lanes; ++lane)
+		{
+			states[lane] = initialState;
+			// A lane without a word of its own runs the first one again.
+			positions[lane] = words[order[first + (lane < numberOfWords ? lane : 0)]].first;
+		}
+
+		for (size_t step = 0; step < length; ++step)
+		{
+			StateId live = deadState;
+			for (size_t lane = 0; lane < lanes; ++lane)
+			{
+				states[lane] = table[states[lane] * width + classes[static_cast<unsigned char>(positions[lane][step])]];
+				live |= states[lane];
+			}
+			if (live == deadState)
+				break;
+		}
+
+		for (size_t lane = 0; lane < numberOfWords; ++lane)
+			results[order[first + lane]] = GetResult(states[lane]);
+	}
+}
+
+// Every word in flight advances by one character per step, and a lane that is done with
+// its word takes the next one. None of the words is empty.
+void CompiledDFA::AcceptsInterleaved(const Word* words, const size_t* order, size_t count, size_t* results) const
+{
+	const StateId* table = transitions;
+	const SymbolClass* classes = symbolClasses;
+	const size_t width = numberOfClasses;
+
+	StateId states[lanes];
+	const char* positions[lanes];
+	const char* ends[lanes];
+	size_t indices[lanes];
+	size_t active = 0, next = 0;
+	for (; active < lanes && next < count; ++active, ++next)
+	{
+		states[active] = initialState;
+		positions[active] = words[order[next]].first;
+		ends[active] = words[order[next]].second;
+		indices[active] = order[next];
+	}
+
+	while (active)
+	{
+		for (size_t lane = 0; lane < active; ++lane)
+		{
+			states[lane] = table[states[lane] * width + classes[static_cast<unsigned char>(*positions[lane]++)]];
+			if (positions[lane] != ends[lane] && states[lane] != deadState)
+				continue;
+
+			results[indices[lane]] = GetResult(states[lane]);
+			if (next == count)
+			{
+				--active;
+				states[lane] = states[active];
+				positions[lane] = positions[active];
+				ends[lane] = ends[active];
+				indices[lane] = indices[active];
+				--lane;
+				continue;
+			}
+
+			states[lane] = initialState;
+			positions[lane] = words[order[next]].first;
+			ends[lane] = words[order[next]].second;
+			indices[lane] = order[next++];
+		}
+	}
+}
+
+std::vector<size_t> CompiledDFA::Accepts(const std::vector<std::string>& words, size_t numberOfThreads) const
+{
+	std::vector<Word> ranges;
+	ranges.reserve(words.size());
+	for (const auto& word : words)
+		ranges.emplace_back(word.data(), word.data() + word.size());
+
+	std::vector<size_t> results(words.size());
+	ParallelFor(ranges.size(), numberOfThreads, [&](size_t begin, size_t end)
+		{
+			Accepts(ranges.data() + begin, end - begin, results.data() + begin);
+		});
+
+	return results;
+}
+
+// One result per line of the buffer; a trailing '\r' is not part of the word.
+std::vector<size_t> CompiledDFA::AcceptsLines(const std::string& buffer, size_t numberOfThreads) const
+{
+	std::vector<Word> lines;
+	const char* first = buffer.data();
+	const char* last = buffer.data() + buffer.size();
+	while (first < last)
+	{
+		const char* second = std::find(first, last, '\n');
+		const char* wordEnd = second;
+		if (wordEnd != first && *(wordEnd - 1) == '\r')
+			--wordEnd;
+		lines.emplace_back(first, wordEnd);
+		first = second + 1;
+	}
+
+	std::vector<size_t> results(lines.size());
+	ParallelFor(lines.size(), numberOfThreads, [&](size_t begin, size_t end)
+		{
+			Accepts(lines.data() + begin, end - begin, results.data() + begin);
+		});
+
+	return results;
+}
+
+size_t CompiledDFA::GetNumberOfStates() const
+{
+	return numberOfStates;
+}
+
+size_t CompiledDFA::GetNumberOfClasses() const
+{
+	return numberOfClasses;
+}
+
+CompiledDFA::StateId CompiledDFA::GetInitialState() const
+{
+	return initialState;
+}
+
+CompiledDFA::StateId CompiledDFA::GetTransition(StateId state, char character) const
+{
+	return transitions[state * numberOfClasses + symbolClasses[static_cast<unsigned char>(character)]];
+}
+
+bool CompiledDFA::IsLive(StateId state) const
+{
+	return state >= firstLiveState;
+}
+
+bool CompiledDFA::IsFinal(StateId state) const
+{
+	return finalStates[state];
+}
+
+DFA::State CompiledDFA::GetStateName(StateId state) const
+{
+	return DFA::State(names + nameOffsets[state], names + nameOffsets[state + 1]);
+}
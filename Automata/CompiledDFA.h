@@ -0,0 +1,68 @@
+#pragma once
+#include "DFA.h"
+#include "AutomatonImage.h"
+#include <cstdint>
+
+class CompiledDFA
+{
+public:
+	using StateId = uint32_t;
+	using SymbolClass = uint8_t;
+	using Word = std::pair<const char*, const char*>;
+
+	static constexpr StateId deadState = 0;
+	static constexpr size_t lanes = 16;
+
+public:
+	CompiledDFA();
+	explicit CompiledDFA(const DFA&);
+
+	bool Save(const std::string&) const;
+	bool Load(const std::string&, bool verify = true);
+
+	size_t Accepts(const std::string&) const;
+	size_t Accepts(const char*, const char*) const;
+	void Accepts(const Word*, size_t, size_t*) const;
+	std::vector<size_t> Accepts(const std::vector<std::string>&, size_t numberOfThreads = 1) const;
+	std::vector<size_t> AcceptsLines(const std::string&, size_t numberOfThreads = 1) const;
+	const char* Run(StateId&, const char*, const char*) const;
+	const char* LongestMatch(const char*, const char*) const;
+
+	size_t GetNumberOfStates() const;
+	size_t GetNumberOfClasses() const;
+	StateId GetInitialState() const;
+	StateId GetTransition(StateId, char) const;
+	bool IsLive(StateId) const;
+	bool IsFinal(StateId) const;
+	DFA::State GetStateName(StateId) const;
+
+private:
+	// The lengths from which the words of a batch are run in lockstep and interleaved,
+	// and from which they are interleaved when the table stays in the cache.
+	static constexpr size_t lockstepLength = 6;
+	static constexpr size_t interleavedLength = 16;
+	static constexpr size_t cachedInterleavedLength = 32;
+	// Tables up to this size, in bytes, are taken to stay in the cache.
+	static constexpr size_t cachedTableSize = size_t(1) << 20;
+	static constexpr char magic[8] = "FLDFA";
+
+	bool Attach(const AutomatonImage&, bool verify);
+
+	size_t GetResult(StateId) const;
+	void AcceptsInLockstep(const Word*, const size_t*, size_t, size_t, size_t*) const;
+	void AcceptsInterleaved(const Word*, const size_t*, size_t, size_t*) const;
+
+private:
+	// Everything below points into the image, which is either built by the
+	// constructor or mapped from a file by Load.
+	AutomatonImage image;
+	const SymbolClass* symbolClasses = nullptr;
+	const StateId* transitions = nullptr;
+	const uint8_t* finalStates = nullptr;
+	const uint32_t* nameOffsets = nullptr;
+	const char* names = nullptr;
+	size_t numberOfStates = 0;
+	size_t numberOfClasses = 1;
+	StateId initialState = deadState;
+	StateId firstLiveState = 1;
+};
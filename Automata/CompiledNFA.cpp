@@ -0,0 +1,296 @@
+#include "CompiledNFA.h"
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+namespace
+{
+	struct Counts
+	{
+		uint32_t numberOfStates;
+		uint32_t numberOfClasses;
+		uint32_t initialState;
+		uint32_t numberOfTargets;
+		uint64_t namesSize;
+	};
+
+	// Offsets of the sections of the payload, each of them 8-byte aligned: counts, byte classes,
+	// target offsets per (state, class), targets, final flags, name offsets, names.
+	struct Layout
+	{
+		size_t symbolClasses, offsets, targets, finalStates, nameOffsets, names, size;
+
+		Layout(size_t numberOfStates, size_t numberOfClasses, size_t numberOfTargets, size_t namesSize)
+		{
+			symbolClasses = AutomatonImage::Align(sizeof(Counts));
+			offsets = symbolClasses + AutomatonImage::Align(256);
+			targets = offsets + AutomatonImage::Align((numberOfStates * numberOfClasses + 1) * sizeof(uint32_t));
+			finalStates = targets + AutomatonImage::Align(numberOfTargets * sizeof(uint32_t));
+			nameOffsets = finalStates + AutomatonImage::Align(numberOfStates);
+			names = nameOffsets + AutomatonImage::Align((numberOfStates + 1) * sizeof(uint32_t));
+			size = names + namesSize;
+		}
+	};
+}
+
+CompiledNFA::CompiledNFA() :
+	CompiledNFA(NFA())
+{
+}
+
+CompiledNFA::CompiledNFA(const NFA& NFA)
+{
+	// Indexed by the ids of the NFA.
+	size_t numberOfIds = 0;
+	for (const auto& state : NFA.GetStates())
+		numberOfIds = std::max<size_t>(numberOfIds, state + 1);
+
+	std::vector<StateId> stateIds(numberOfIds);
+	std::vector<std::string> stateNames;
+	for (const auto& state : NFA.GetStates())
+	{
+		stateIds[state] = static_cast<StateId>(stateNames.size());
+		stateNames.push_back(NFA.GetStateName(state));
+	}
+
+	StateId initial = 0;
+	if (NFA.GetStates().Contains(NFA.GetInitialState()))
+		initial = stateIds[NFA.GetInitialState()];
+
+	// Lambda transitions are compiled away: a symbol leads from a state to the closure of
+	// the states its closure reaches, and a state is final if its closure has a final state.
+	const EpsilonClosures& closures = NFA.GetClosures();
+	std::vector<std::vector<NFA::StateId>> closure(numberOfIds);
+	for (const auto& state : NFA.GetStates())
+	{
+		closure[state].push_back(state);
+		closures.Close(closure[state]);
+	}
+	std::vector<NFA::StateId> reached;
+
+	// As in CompiledDFA, bytes with the same transitions from every state share a class;
+	// class 0 is the one of the bytes that are not symbols of the NFA.
+	using Column = std::vector<std::vector<StateId>>;
+	std::map<Column, SymbolClass> classes;
+	std::vector<Column> columns(1, Column(stateNames.size()));
+	classes.insert(std::make_pair(columns[0], 0));
+	SymbolClass byteClasses[256] = {};
+	for (const auto& symbol : NFA.GetSymbols())
+	{
+		Column column(stateNames.size());
+		for (const auto& state : NFA.GetStates())
+		{
+			auto& cell = column[stateIds[state]];
+			for (const auto& closureState : closure[state])
+				for (const auto& nextState : NFA.GetTransitions(closureState, symbol))
+					reached.push_back(nextState);
+			closures.Close(reached);
+			for (const auto& nextState : reached)
+				if (NFA.GetStates().Contains(nextState))
+					cell.push_back(stateIds[nextState]);
+			reached.clear();
+
+			std::sort(cell.begin(), cell.end());
+			cell.erase(std::unique(cell.begin(), cell.end()), cell.end());
+		}
+
+		const auto& it = classes.insert(std::make_pair(column, static_cast<SymbolClass>(columns.size())));
+		if (it.second)
+			columns.push_back(std::move(column));
+		byteClasses[static_cast<unsigned char>(symbol)] = it.first->second;
+	}
+
+	size_t numberOfTargets = 0;
+	for (const auto& column : columns)
+		for (const auto& cell : column)
+			numberOfTargets += cell.size();
+
+	size_t namesSize = 0;
+	for (const auto& name : stateNames)
+		namesSize += name.size();
+
+	Layout layout(stateNames.size(), columns.size(), numberOfTargets, namesSize);
+	AutomatonImage built(magic, layout.size);
+	char* payload = built.GetPayload();
+
+	Counts* counts = reinterpret_cast<Counts*>(payload);
+	counts->numberOfStates = static_cast<uint32_t>(stateNames.size());
+	counts->numberOfClasses = static_cast<uint32_t>(columns.size());
+	counts->initialState = initial;
+	counts->numberOfTargets = static_cast<uint32_t>(numberOfTargets);
+	counts->namesSize = namesSize;
+
+	std::memcpy(payload + layout.symbolClasses, byteClasses, sizeof(byteClasses));
+
+	uint32_t* cells = reinterpret_cast<uint32_t*>(payload + layout.offsets);
+	StateId* allTargets = reinterpret_cast<StateId*>(payload + layout.targets);
+	uint32_t count = 0;
+	for (size_t state = 0; state < stateNames.size(); ++state)
+		for (size_t symbolClass = 0; symbolClass < columns.size(); ++symbolClass)
+		{
+			cells[state * columns.size() + symbolClass] = count;
+			for (const auto& nextState : columns[symbolClass][state])
+				allTargets[count++] = nextState;
+		}
+	cells[stateNames.size() * columns.size()] = count;
+
+	uint8_t* finals = reinterpret_cast<uint8_t*>(payload + layout.finalStates);
+	for (const auto& state : NFA.GetStates())
+		for (const auto& closureState : closure[state])
+			if (NFA.GetFinalStates().Contains(closureState))
+				finals[stateIds[state]] = 1;
+
+	uint32_t* nameCells = reinterpret_cast<uint32_t*>(payload + layout.nameOffsets);
+	char* text = payload + layout.names;
+	nameCells[0] = 0;
+	for (size_t state = 0; state < stateNames.size(); ++state)
+	{
+		std::memcpy(text + nameCells[state], stateNames[state].data(), stateNames[state].size());
+		nameCells[state + 1] = nameCells[state] + static_cast<uint32_t>(stateNames[state].size());
+	}
+
+	built.Seal();
+	Attach(built, false);
+}
+
+bool CompiledNFA::Save(const std::string& fileName) const
+{
+	return image.Save(fileName);
+}
+
+// Same as CompiledDFA::Load.
+bool CompiledNFA::Load(const std::string& fileName, bool verify)
+{
+	AutomatonImage loaded;
+	if (!loaded.Load(fileName, magic, verify))
+		return false;
+	return Attach(loaded, verify);
+}
+
+bool CompiledNFA::Attach(const AutomatonImage& source, bool verify)
+{
+	const char* payload = source.GetPayload();
+	if (source.GetPayloadSize() < sizeof(Counts))
+		return false;
+
+	const Counts* counts = reinterpret_cast<const Counts*>(payload);
+	if (counts->numberOfClasses == 0 || counts->numberOfClasses > 256 ||
+		(counts->numberOfStates != 0 && counts->initialState >= counts->numberOfStates))
+		return false;
+
+	Layout layout(counts->numberOfStates, counts->numberOfClasses, counts->numberOfTargets, counts->namesSize);
+	if (layout.size > source.GetPayloadSize())
+		return false;
+
+	const SymbolClass* byteClasses = reinterpret_cast<const SymbolClass*>(payload + layout.symbolClasses);
+	const uint32_t* cells = reinterpret_cast<const uint32_t*>(payload + layout.offsets);
+	const StateId* allTargets = reinterpret_cast<const StateId*>(payload + layout.targets);
+	const uint32_t* nameCells = reinterpret_cast<const uint32_t*>(payload + layout.nameOffsets);
+	if (verify)
+	{
+		for (size_t byte = 0; byte < 256; ++byte)
+			if (byteClasses[byte] >= counts->numberOfClasses)
+				return false;
+
+		size_t numberOfCells = size_t(counts->numberOfStates) * counts->numberOfClasses;
+		for (size_t cell = 0; cell < numberOfCells; ++cell)
+			if (cells[cell] > cells[cell + 1])
+				return false;
+		if (cells[0] != 0 || cells[numberOfCells] != counts->numberOfTargets)
+			return false;
+
+		for (size_t index = 0; index < counts->numberOfTargets; ++index)
+			if (allTargets[index] >= counts->numberOfStates)
+				return false;
+
+		for (size_t state = 0; state < counts->numberOfStates; ++state)
+			if (nameCells[state] > nameCells[state + 1])
+				return false;
+		if (nameCells[0] != 0 || nameCells[counts->numberOfStates] != counts->namesSize)
+			return false;
+	}
+
+	image = source;
+	symbolClasses = byteClasses;
+	offsets = cells;
+	targets = allTargets;
+	finalStates = reinterpret_cast<const uint8_t*>(payload + layout.finalStates);
+	nameOffsets = nameCells;
+	names = payload + layout.names;
+	numberOfStates = counts->numberOfStates;
+	numberOfClasses = counts->numberOfClasses;
+	initialState = counts->initialState;
+	return true;
+}
+
+// O(l * m), l = word.length(), m = number of transitions, keeping the set of current states
+bool CompiledNFA::Accepts(const std::string& word) const
+{
+	if (numberOfStates == 0)
+		return false;
+
+	std::vector<StateId> currStates(1, initialState), nextStates;
+	std::vector<uint8_t> visited(numberOfStates, 0);
+	for (const auto& character : word)
+	{
+		nextStates.clear();
+		for (const auto& state : currStates)
+		{
+			Targets transition = GetTransitions(state, character);
+			for (const StateId* nextState = transition.first; nextState != transition.second; ++nextState)
+				if (!visited[*nextState])
+				{
+					visited[*nextState] = 1;
+					nextStates.push_back(*nextState);
+				}
+		}
+
+		if (nextStates.empty())
+			return false;
+
+		for (const auto& state : nextStates)
+			visited[state] = 0;
+		currStates.swap(nextStates);
+	}
+
+	for (const auto& state : currStates)
+		if (finalStates[state])
+			return true;
+	return false;
+}
+
+size_t CompiledNFA::GetNumberOfStates() const
+{
+	return numberOfStates;
+}
+
+size_t CompiledNFA::GetNumberOfClasses() const
+{
+	return numberOfClasses;
+}
+
+CompiledNFA::StateId CompiledNFA::GetInitialState() const
+{
+	return initialState;
+}
+
+CompiledNFA::SymbolClass CompiledNFA::GetSymbolClass(char character) const
+{
+	return symbolClasses[static_cast<unsigned char>(character)];
+}
+
+CompiledNFA::Targets CompiledNFA::GetTransitions(StateId state, char character) const
+{
+	size_t cell = state * numberOfClasses + symbolClasses[static_cast<unsigned char>(character)];
+	return Targets(targets + offsets[cell], targets + offsets[cell + 1]);
+}
+
+bool CompiledNFA::IsFinal(StateId state) const
+{
+	return finalStates[state];
+}
+
+std::string CompiledNFA::GetStateName(StateId state) const
+{
+	return std::string(names + nameOffsets[state], names + nameOffsets[state + 1]);
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "NFA.h"
+#include "AutomatonImage.h"
+#include <cstdint>
+
+// The NFA with states numbered and transitions stored per (state, symbol class) as
+// ranges of one array of targets. Like CompiledDFA it can be saved to a binary file
+// and loaded back by mapping the file, without parsing anything.
+class CompiledNFA
+{
+public:
+	using StateId = uint32_t;
+	using SymbolClass = uint8_t;
+	using Targets = std::pair<const StateId*, const StateId*>;
+
+public:
+	CompiledNFA();
+	explicit CompiledNFA(const NFA&);
+
+	bool Save(const std::string&) const;
+	bool Load(const std::string&, bool verify = true);
+
+	bool Accepts(const std::string&) const;
+
+	size_t GetNumberOfStates() const;
+	size_t GetNumberOfClasses() const;
+	StateId GetInitialState() const;
+	SymbolClass GetSymbolClass(char) const;
+	Targets GetTransitions(StateId, char) const;
+	bool IsFinal(StateId) const;
+	std::string GetStateName(StateId) const;
+
+private:
+	static constexpr char magic[8] = "FLNFA";
+
+	bool Attach(const AutomatonImage&, bool verify);
+
+private:
+	AutomatonImage image;
+	const SymbolClass* symbolClasses = nullptr;
+	const uint32_t* offsets = nullptr;
+	const StateId* targets = nullptr;
+	const uint8_t* finalStates = nullptr;
+	const uint32_t* nameOffsets = nullptr;
+	const char* names = nullptr;
+	size_t numberOfStates = 0;
+	size_t numberOfClasses = 1;
+	StateId initialState = 0;
+};
@@ -0,0 +1,287 @@
+#include "DFA.h"
+#include "ElementsParser.h"
+#include "Minimization.h"
+
+bool DFA::Verify() const
+{
+	if (!GetStates().Contains(GetInitialState()))
+		return false;
+
+	for (const auto& finalState : GetFinalStates())
+		if (!GetStates().Contains(finalState))
+			return false;
+
+	for (const auto& transition : GetTransitionTable())
+	{
+		if (!GetStates().Contains(transition.first.first))
+			return false;
+		if (GetSymbols().find(transition.first.second) == GetSymbols().end())
+			return false;
+		if (!GetStates().Contains(transition.second))
+			return false;
+	}
+
+	return true;
+}
+
+// O(l), l = word.length()
+size_t DFA::Accepts(const std::string& word) const
+{
+	StateId currState = GetInitialState();
+	for (const auto& character : word)
+	{
+		currState = GetTransition(currState, character);
+		if (currState == noState)
+			return -1;
+	}
+
+	if (!GetFinalStates().Contains(currState))
+		return 0;
+	return 1;
+}
+
+void DFA::Print(std::ostream& out) const
+{
+	out << "      || ";
+	for (const auto& symbol : GetSymbols())
+		out << symbol << "   ";
+
+	out << std::endl;
+
+	out << "------++";
+	for (size_t index = 0; index < GetSymbols().size(); ++index)
+		out << "----";
+	out << std::endl;
+
+	for (const auto& currState : GetStates())
+	{
+		if (currState == GetInitialState())
+			out << "-> ";
+		else
+			if (GetFinalStates().Contains(currState))
+				out << " * ";
+			else
+				out << "   ";
+
+		out << GetStateName(currState) << " ||";
+
+		for (const auto& symbol : GetSymbols())
+		{
+			StateId nextState = GetTransition(currState, symbol);
+			if (nextState != noState)
+				out << " " << GetStateName(nextState) << " ";
+			else
+				out << "    ";
+		}
+		out << std::endl;
+	}
+	out << std::endl;
+}
+
+void DFA::PrintDefinition(std::ostream& out) const
+{
+	out << "({";
+	for (const auto& state : GetStates())
+		out << GetStateName(state) << ", ";
+	out << "\b\b}, {";
+	for (const auto& symbol : GetSymbols())
+		out << symbol << ", ";
+	out << "\b\b}, d, " << GetStateName(GetInitialState()) << ", {";
+	for (const auto& finalState : GetFinalStates())
+		out << GetStateName(finalState) << ", ";
+	out << "\b\b})\nd = {\n";
+	for (const auto& state : GetStates())
+		for (const auto& symbol : GetSymbols())
+		{
+			StateId nextState = GetTransition(state, symbol);
+			if (nextState != noState)
+				out << "	(" << GetStateName(state) << ", " << symbol << ") -> " << GetStateName(nextState) << "\n";
+		}
+	out << "    }\n\n";
+}
+
+// Every name is interned as it is read; whether it was declared as a state is up to Verify.
+// The symbols section is optional, symbols used by transitions are added anyway, and a
+// transition to "-" is a missing one.
+std::istream& operator>>(std::istream& in, DFA& obj)
+{
+	ElementsParser::Parse(in, [&obj](ElementsParser& parser)
+		{
+			// The declared counts size the tables up front, so reading never rehashes them.
+			size_t numberOfStates = parser.ReadCount();
+			obj.stateTable.Reserve(obj.stateTable.GetSize() + numberOfStates);
+			for (size_t index = 0; index < numberOfStates; ++index)
+				obj.states.Insert(obj.stateTable.Intern(parser.ReadName()));
+
+			if (parser.AtSymbols())
+			{
+				size_t numberOfSymbols = parser.ReadCount();
+				for (size_t index = 0; index < numberOfSymbols; ++index)
+					obj.InsertSymbol(parser.ReadSymbol());
+			}
+
+			size_t numberOfTransitions = parser.ReadCount();
+			obj.transitionTable.reserve(obj.transitionTable.size() + numberOfTransitions);
+			// The transitions of a state usually follow each other, so its name is only
+			// looked up again when it changes; the same goes for the symbols.
+			std::string_view lastName;
+			DFA::StateId state = DFA::noState;
+			bool isSymbol[256] = {};
+			for (size_t index = 0; index < numberOfTransitions; ++index)
+			{
+				std::string_view name = parser.ReadName();
+				if (state == DFA::noState || name != lastName)
+				{
+					state = obj.stateTable.Intern(name);
+					lastName = name;
+				}
+
+				DFA::Symbol symbol = parser.ReadSymbol();
+				std::string_view state2 = parser.ReadName();
+				if (state2 != "-")
+					obj.InsertTransition(std::make_pair(state, symbol), obj.stateTable.Intern(state2));
+				if (!isSymbol[static_cast<unsigned char>(symbol)])
+				{
+					isSymbol[static_cast<unsigned char>(symbol)] = true;
+					obj.InsertSymbol(symbol);
+				}
+			}
+
+			obj.initialState = obj.stateTable.Intern(parser.ReadName());
+
+			size_t numberOfFinalStates = parser.ReadCount();
+			for (size_t index = 0; index < numberOfFinalStates; ++index)
+				obj.InsertFinalState(obj.stateTable.Intern(parser.ReadName()));
+		});
+
+	return in;
+}
+
+// Writes the description in the format operator>> reads.
+std::ostream& operator<<(std::ostream& out, const DFA& obj)
+{
+	size_t numberOfTransitions = 0;
+	for (const auto& state : obj.GetStates())
+		for (const auto& symbol : obj.GetSymbols())
+			if (obj.GetTransition(state, symbol) != DFA::noState)
+				++numberOfTransitions;
+
+	out << obj.GetStates().size() << std::endl;
+	for (const auto& state : obj.GetStates())
+		out << obj.GetStateName(state) << " ";
+
+	out << std::endl << obj.GetSymbols().size() << std::endl;
+	for (const auto& symbol : obj.GetSymbols())
+		out << symbol << " ";
+
+	out << std::endl << numberOfTransitions << std::endl;
+	for (const auto& state : obj.GetStates())
+	{
+		for (const auto& symbol : obj.GetSymbols())
+		{
+			DFA::StateId nextState = obj.GetTransition(state, symbol);
+			if (nextState != DFA::noState)
+				out << obj.GetStateName(state) << " " << symbol << " " << obj.GetStateName(nextState) << std::endl;
+		}
+	}
+
+	out << obj.GetStateName(obj.GetInitialState()) << std::endl;
+
+	out << obj.GetFinalStates().size() << std::endl;
+	for (const auto& finalState : obj.GetFinalStates())
+		out << obj.GetStateName(finalState) << " ";
+	return out;
+}
+
+const StateSet& DFA::GetStates() const
+{
+	return states;
+}
+
+const std::set<DFA::Symbol>& DFA::GetSymbols() const
+{
+	return symbols;
+}
+
+const DFA::TransitionTable& DFA::GetTransitionTable() const
+{
+	return transitionTable;
+}
+
+DFA::StateId DFA::GetTransition(StateId state, Symbol symbol) const
+{
+	const auto& it = transitionTable.find(std::make_pair(state, symbol));
+	if (it == transitionTable.end())
+		return noState;
+	return it->second;
+}
+
+DFA::StateId DFA::GetInitialState() const
+{
+	return initialState;
+}
+
+const StateSet& DFA::GetFinalStates() const
+{
+	return finalStates;
+}
+
+const DFA::State& DFA::GetStateName(StateId state) const
+{
+	return stateTable.GetName(state);
+}
+
+// noState if the name was never used.
+DFA::StateId DFA::GetStateId(const State& state) const
+{
+	return stateTable.Find(state);
+}
+
+DFA::StateId DFA::InsertState(const State& state)
+{
+	StateId id = stateTable.Intern(state);
+	states.Insert(id);
+	return id;
+}
+
+void DFA::InsertSymbol(const Symbol symbol)
+{
+	symbols.insert(symbol);
+}
+
+void DFA::InsertTransition(const std::pair<StateId, Symbol>& key, StateId value)
+{
+	transitionTable.insert(std::make_pair(key, value));
+}
+
+void DFA::SetInitialState(StateId state)
+{
+	initialState = state;
+}
+
+void DFA::InsertFinalState(StateId state)
+{
+	finalStates.Insert(state);
+}
+
+void DFA::RemoveState(StateId state)
+{
+	states.Erase(state);
+	finalStates.Erase(state);
+}
+
+void DFA::RemoveStates(const std::vector<StateId>& removed)
+{
+	states.Erase(removed);
+	finalStates.Erase(removed);
+}
+
+void DFA::RemoveTransition(StateId state, Symbol symbol)
+{
+	transitionTable.erase(std::make_pair(state, symbol));
+}
+
+MinimizationReport DFA::Minimize(DFA& DFA, MinimizationAlgorithm algorithm, std::ostream* trace, size_t numberOfThreads)
+{
+	return Minimization::Minimize(DFA, algorithm, trace, numberOfThreads);
+}
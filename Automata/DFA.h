@@ -0,0 +1,89 @@
+#pragma once
+#include <iostream>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <set>
+#include "StateTable.h"
+#include "FlatHashMap.h"
+
+// Mixes both hashes into every bit (SplitMix64), since std::hash of an integer is the integer.
+class Hash
+{
+public:
+	template<class T1, class T2>
+	std::size_t operator()(const std::pair<T1, T2>& pair) const
+	{
+		uint64_t hash = static_cast<uint64_t>(std::hash<T1>()(pair.first)) * 0x9E3779B97F4A7C15ull + std::hash<T2>()(pair.second);
+		hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+		hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+		return static_cast<std::size_t>(hash ^ (hash >> 31));
+	}
+};
+
+// FNV-1a over the state ids of a sorted subset, for the subset constructions.
+class SubsetHash
+{
+public:
+	std::size_t operator()(const std::vector<uint32_t>& subset) const
+	{
+		uint64_t hash = subset.size();
+		for (const auto& state : subset)
+			hash = (hash ^ state) * 0x100000001B3ull;
+		return static_cast<std::size_t>(hash);
+	}
+};
+
+enum class MinimizationAlgorithm;
+struct MinimizationReport;
+
+class DFA
+{
+public:
+	using State = std::string;
+	using StateId = StateTable::Id;
+	using Symbol = char;
+	using TransitionTable = FlatHashMap<std::pair<StateId, Symbol>, StateId, Hash>;
+
+	static constexpr StateId noState = StateTable::noId;
+
+public:
+	DFA() = default;
+
+	bool Verify() const;
+	size_t Accepts(const std::string&) const;
+	friend std::istream& operator>>(std::istream&, DFA&);
+	friend std::ostream& operator<<(std::ostream&, const DFA&);
+	void Print(std::ostream&) const;
+	void PrintDefinition(std::ostream&) const;
+
+	const StateSet& GetStates() const;
+	const std::set<Symbol>& GetSymbols() const;
+	const TransitionTable& GetTransitionTable() const;
+	StateId GetTransition(StateId, Symbol) const;
+	StateId GetInitialState() const;
+	const StateSet& GetFinalStates() const;
+	const State& GetStateName(StateId) const;
+	StateId GetStateId(const State&) const;
+
+	StateId InsertState(const State&);
+	void InsertSymbol(const Symbol);
+	void InsertTransition(const std::pair<StateId, Symbol>&, StateId);
+	void SetInitialState(StateId);
+	void InsertFinalState(StateId);
+
+	void RemoveState(StateId);
+	void RemoveStates(const std::vector<StateId>&);
+	void RemoveTransition(StateId, Symbol);
+
+	// See Minimization.h; numberOfThreads == 0 uses every hardware thread.
+	static MinimizationReport Minimize(DFA&, MinimizationAlgorithm, std::ostream* trace = nullptr, size_t numberOfThreads = 0);
+
+private:
+	StateTable stateTable;
+	StateSet states;
+	std::set<Symbol> symbols;
+	TransitionTable transitionTable;
+	StateId initialState = noState;
+	StateSet finalStates;
+};
@@ -0,0 +1,217 @@
+#include "ElementsParser.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+	// std::isspace goes through the locale for every character.
+	bool IsSpace(char character)
+	{
+		return character == ' ' || (character >= '\t' && character <= '\r');
+	}
+
+	bool IsCount(std::string_view token)
+	{
+		return !token.empty() && std::all_of(token.begin(), token.end(), [](char character)
+			{
+				return character >= '0' && character <= '9';
+			});
+	}
+
+	// The tokens of the next line that has any, and the position after that line.
+	const char* ReadLine(const char* first, const char* end, std::vector<std::string_view>& tokens)
+	{
+		tokens.clear();
+		while (first != end && tokens.empty())
+		{
+			while (first != end && *first != '\n')
+			{
+				if (IsSpace(*first))
+				{
+					++first;
+					continue;
+				}
+
+				const char* token = first;
+				while (first != end && !IsSpace(*first))
+					++first;
+				tokens.emplace_back(token, first - token);
+			}
+
+			if (first != end)
+				++first;
+		}
+
+		return first;
+	}
+}
+
+ParseError::ParseError(const std::string& message, size_t line, size_t column) :
+	std::runtime_error("line " + std::to_string(line) + ", column " + std::to_string(column) + ": " + message),
+	line(line),
+	column(column)
+{
+}
+
+size_t ParseError::GetLine() const
+{
+	return line;
+}
+
+size_t ParseError::GetColumn() const
+{
+	return column;
+}
+
+ElementsParser::ElementsParser(const char* begin, const char* end) :
+	begin(begin),
+	end(end),
+	position(begin)
+{
+}
+
+// A malformed count is reported where it starts, not where it stops being a number.
+size_t ElementsParser::ReadCount()
+{
+	SkipWhitespace();
+	if (position == end || *position < '0' || *position > '9')
+		Fail("expected a number");
+
+	const char* first = position;
+	size_t count = 0;
+	for (; position != end && *position >= '0' && *position <= '9'; ++position)
+	{
+		size_t digit = *position - '0';
+		if (count > (SIZE_MAX - digit) / 10)
+		{
+			position = first;
+			Fail("number too large");
+		}
+		count = count * 10 + digit;
+	}
+
+	if (position != end && !IsSpace(*position))
+	{
+		position = first;
+		Fail("expected a number");
+	}
+	return count;
+}
+
+std::string_view ElementsParser::ReadName()
+{
+	SkipWhitespace();
+	if (position == end)
+		Fail("unexpected end of input");
+
+	const char* first = position;
+	while (position != end && !IsSpace(*position))
+		++position;
+	return std::string_view(first, position - first);
+}
+
+char ElementsParser::ReadSymbol()
+{
+	std::string_view name = ReadName();
+	if (name.size() != 1)
+	{
+		position -= name.size();
+		Fail("expected a single character symbol");
+	}
+
+	return name[0];
+}
+
+// True when nothing but blanks is left on the current line.
+bool ElementsParser::AtLineEnd()
+{
+	while (position != end && (*position == ' ' || *position == '\t' || *position == '\r'))
+		++position;
+	return position == end || *position == '\n';
+}
+
+// Some descriptions list their symbols between the states and the transitions: a count
+// and that many one-character symbols on the next line, followed by the line with the
+// number of transitions. Others leave them out, so this looks ahead without consuming.
+bool ElementsParser::AtSymbols() const
+{
+	std::vector<std::string_view> tokens;
+	const char* first = ReadLine(position, end, tokens);
+	if (tokens.size() != 1 || !IsCount(tokens[0]) || tokens[0].size() > 3)
+		return false;
+
+	size_t numberOfSymbols = std::stoul(std::string(tokens[0]));
+	if (numberOfSymbols)
+	{
+		first = ReadLine(first, end, tokens);
+		if (tokens.size() != numberOfSymbols)
+			return false;
+		for (const auto& token : tokens)
+			if (token.size() != 1)
+				return false;
+	}
+
+	ReadLine(first, end, tokens);
+	return tokens.size() == 1 && IsCount(tokens[0]);
+}
+
+// True when nothing but whitespace is left.
+bool ElementsParser::AtEnd() const
+{
+	return std::all_of(position, end, IsSpace);
+}
+
+size_t ElementsParser::GetConsumed() const
+{
+	return position - begin;
+}
+
+// The line and column are only computed here, so reading tokens does not keep track of them.
+void ElementsParser::Fail(const std::string& message) const
+{
+	size_t line = 1 + std::count(begin, position, '\n');
+	const char* lineBegin = position;
+	while (lineBegin != begin && *(lineBegin - 1) != '\n')
+		--lineBegin;
+	throw ParseError(message, line, position - lineBegin + 1);
+}
+
+std::string ElementsParser::ReadAll(std::istream& in)
+{
+	std::string buffer;
+	std::streambuf* source = in.rdbuf();
+	if (!source)
+		return buffer;
+
+	// When the stream can seek, the rest of it is read with one call; otherwise in chunks.
+	size_t chunkSize = 1 << 20;
+	std::streampos current = source->pubseekoff(0, std::ios::cur, std::ios::in);
+	std::streampos last = source->pubseekoff(0, std::ios::end, std::ios::in);
+	if (current != std::streampos(-1) && last != std::streampos(-1))
+	{
+		source->pubseekpos(current, std::ios::in);
+		chunkSize = std::max<size_t>(chunkSize, static_cast<size_t>(last - current) + 1);
+	}
+
+	size_t size = 0;
+	for (;;)
+	{
+		buffer.resize(size + chunkSize);
+		std::streamsize count = source->sgetn(&buffer[size], chunkSize);
+		size += static_cast<size_t>(count);
+		if (count < static_cast<std::streamsize>(chunkSize))
+			break;
+		chunkSize = size;
+	}
+
+	buffer.resize(size);
+	in.setstate(std::ios::eofbit);
+	return buffer;
+}
+
+void ElementsParser::SkipWhitespace()
+{
+	while (position != end && IsSpace(*position))
+		++position;
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+// Thrown with the line and column (both starting at 1) where the input stops
+// matching the expected format.
+class ParseError : public std::runtime_error
+{
+public:
+	ParseError(const std::string& message, size_t line, size_t column);
+
+	size_t GetLine() const;
+	size_t GetColumn() const;
+
+private:
+	size_t line;
+	size_t column;
+};
+
+// Reads the tokens of an elements.txt description out of a buffer: counts, state
+// names of any length and one-character symbols, all separated by whitespace.
+// Names are views into the buffer, so nothing is copied until the caller stores them.
+class ElementsParser
+{
+public:
+	ElementsParser(const char* begin, const char* end);
+
+	size_t ReadCount();
+	std::string_view ReadName();
+	char ReadSymbol();
+	bool AtLineEnd();
+	bool AtSymbols() const;
+
+	bool AtEnd() const;
+	size_t GetConsumed() const;
+	[[noreturn]] void Fail(const std::string& message) const;
+
+	static std::string ReadAll(std::istream&);
+
+	// Parses the rest of the stream with the given function. If anything but whitespace
+	// follows the last token read, the stream is left right before it, so that several
+	// descriptions can follow each other in one file.
+	template<class Function>
+	static void Parse(std::istream& in, Function function)
+	{
+		std::streampos start = in.tellg();
+		std::string buffer = ReadAll(in);
+		ElementsParser parser(buffer.data(), buffer.data() + buffer.size());
+		function(parser);
+
+		if (!parser.AtEnd() && start != std::streampos(-1))
+		{
+			in.clear();
+			in.seekg(start);
+			in.ignore(static_cast<std::streamsize>(parser.GetConsumed()));
+		}
+	}
+
+private:
+	void SkipWhitespace();
+
+private:
+	const char* begin;
+	const char* end;
+	const char* position;
+};
@@ -0,0 +1,167 @@
+#include "EpsilonClosures.h"
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace
+{
+	constexpr uint32_t noRow = UINT32_MAX;
+}
+
+// The components are found with Tarjan's algorithm, run without recursion. A component is
+// completed after every component it reaches, so its closure is the union of its members
+// and of closures that are already computed. Components of one state without lambda
+// transitions get no bitset.
+EpsilonClosures::EpsilonClosures(const std::vector<std::vector<StateId>>& lambdaTransitions) :
+	numberOfIds(lambdaTransitions.size()),
+	numberOfWords((lambdaTransitions.size() + 63) / 64),
+	components(lambdaTransitions.size(), noRow)
+{
+	const uint32_t unvisited = UINT32_MAX;
+	std::vector<uint32_t> order(numberOfIds, unvisited), lowLink(numberOfIds, 0);
+	std::vector<bool> onStack(numberOfIds, false);
+	std::vector<StateId> stack;
+	std::vector<std::pair<StateId, size_t>> calls;
+	uint32_t counter = 0;
+
+	for (StateId root = 0; root < numberOfIds; ++root)
+	{
+		if (order[root] != unvisited || lambdaTransitions[root].empty())
+			continue;
+
+		calls.emplace_back(root, 0);
+		while (!calls.empty())
+		{
+			auto& [state, edge] = calls.back();
+			if (edge == 0 && order[state] == unvisited)
+			{
+				order[state] = lowLink[state] = counter++;
+				stack.push_back(state);
+				onStack[state] = true;
+			}
+
+			if (edge < lambdaTransitions[state].size())
+			{
+				StateId nextState = lambdaTransitions[state][edge++];
+				if (nextState >= numberOfIds)
+					continue;
+				if (order[nextState] == unvisited)
+					calls.emplace_back(nextState, 0);
+				else if (onStack[nextState])
+					lowLink[state] = std::min(lowLink[state], order[nextState]);
+				continue;
+			}
+
+			StateId finished = state;
+			calls.pop_back();
+			if (!calls.empty())
+				lowLink[calls.back().first] = std::min(lowLink[calls.back().first], lowLink[finished]);
+			if (lowLink[finished] != order[finished])
+				continue;
+
+			size_t first = stack.size();
+			do
+				--first;
+			while (stack[first] != finished);
+
+			bool trivial = stack.size() - first == 1 && lambdaTransitions[finished].empty();
+			if (!trivial)
+			{
+				uint32_t row = static_cast<uint32_t>(closures.size() / numberOfWords);
+				closures.resize(closures.size() + numberOfWords, 0);
+				for (size_t index = first; index < stack.size(); ++index)
+					components[stack[index]] = row;
+
+				Word* closure = &closures[row * numberOfWords];
+				for (size_t index = first; index < stack.size(); ++index)
+				{
+					StateId member = stack[index];
+					closure[member / 64] |= Word(1) << (member % 64);
+					for (const auto& target : lambdaTransitions[member])
+					{
+						if (target >= numberOfIds || components[target] == row)
+							continue;
+						if (components[target] == noRow)
+							closure[target / 64] |= Word(1) << (target % 64);
+						else
+						{
+							const Word* reached = &closures[components[target] * numberOfWords];
+							for (size_t word = 0; word < numberOfWords; ++word)
+								closure[word] |= reached[word];
+						}
+					}
+				}
+				empty = false;
+			}
+
+			for (size_t index = first; index < stack.size(); ++index)
+				onStack[stack[index]] = false;
+			stack.resize(first);
+		}
+	}
+}
+
+bool EpsilonClosures::IsEmpty() const
+{
+	return empty;
+}
+
+size_t EpsilonClosures::GetNumberOfComponents() const
+{
+	return numberOfWords ? closures.size() / numberOfWords : 0;
+}
+
+size_t EpsilonClosures::GetNumberOfWords() const
+{
+	return numberOfWords;
+}
+
+// nullptr if the state reaches no other state, its closure being only itself.
+const EpsilonClosures::Word* EpsilonClosures::GetClosure(StateId state) const
+{
+	if (state >= numberOfIds || components[state] == noRow)
+		return nullptr;
+	return &closures[components[state] * numberOfWords];
+}
+
+bool EpsilonClosures::Contains(StateId state, StateId reached) const
+{
+	const Word* closure = GetClosure(state);
+	if (!closure)
+		return state == reached;
+	return reached < numberOfIds && (closure[reached / 64] >> (reached % 64) & 1);
+}
+
+// Replaces the states by the union of their closures, sorted by id.
+void EpsilonClosures::Close(std::vector<StateId>& states) const
+{
+	if (empty)
+		return;
+
+	std::vector<Word> closure(numberOfWords, 0);
+	std::vector<StateId> others;
+	for (const auto& state : states)
+	{
+		if (state >= numberOfIds)
+		{
+			others.push_back(state);
+			continue;
+		}
+
+		const Word* reached = GetClosure(state);
+		if (!reached)
+			closure[state / 64] |= Word(1) << (state % 64);
+		else
+			for (size_t word = 0; word < numberOfWords; ++word)
+				closure[word] |= reached[word];
+	}
+
+	states.clear();
+	for (size_t word = 0; word < numberOfWords; ++word)
+		for (Word bits = closure[word]; bits; bits &= bits - 1)
+			states.push_back(static_cast<StateId>(word * 64 + std::countr_zero(bits)));
+
+	std::sort(others.begin(), others.end());
+	others.erase(std::unique(others.begin(), others.end()), others.end());
+	states.insert(states.end(), others.begin(), others.end());
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include "StateTable.h"
+#include <cstdint>
+#include <vector>
+
+// The states reachable from each state through lambda transitions, itself included, one
+// bitset per strongly connected component of the lambda transitions, since the states of
+// a component share their closure.
+class EpsilonClosures
+{
+public:
+	using StateId = StateTable::Id;
+	using Word = uint64_t;
+
+public:
+	EpsilonClosures() = default;
+	// lambdaTransitions[state] are the targets of the lambda transitions of state, for every
+	// id below lambdaTransitions.size().
+	explicit EpsilonClosures(const std::vector<std::vector<StateId>>& lambdaTransitions);
+
+	bool IsEmpty() const;
+	size_t GetNumberOfComponents() const;
+	size_t GetNumberOfWords() const;
+	const Word* GetClosure(StateId) const;
+	bool Contains(StateId, StateId) const;
+
+	void Close(std::vector<StateId>&) const;
+
+private:
+	size_t numberOfIds = 0;
+	size_t numberOfWords = 0;
+	bool empty = true;
+	std::vector<uint32_t> components;
+	// closures[component * numberOfWords + word]
+	std::vector<Word> closures;
+};
@@ -0,0 +1,186 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// A hash map kept in one array, with linear probing and no tombstones: erasing moves
+// back the entries that probed past the erased one. Lookups read consecutive slots
+// instead of following bucket lists, so Hasher has to spread keys over the low bits.
+// Inserting can move every entry, so references into the map do not survive it.
+template<class Key, class Value, class Hasher>
+class FlatHashMap
+{
+public:
+	using value_type = std::pair<Key, Value>;
+
+	class const_iterator
+	{
+	public:
+		const_iterator(const FlatHashMap* map, size_t slot) :
+			map(map),
+			slot(slot)
+		{
+			SkipEmpty();
+		}
+
+		const value_type& operator*() const { return map->slots[slot]; }
+		const value_type* operator->() const { return &map->slots[slot]; }
+		bool operator==(const const_iterator& other) const { return slot == other.slot; }
+		bool operator!=(const const_iterator& other) const { return slot != other.slot; }
+
+		const_iterator& operator++()
+		{
+			++slot;
+			SkipEmpty();
+			return *this;
+		}
+
+	private:
+		void SkipEmpty()
+		{
+			while (slot < map->used.size() && !map->used[slot])
+				++slot;
+		}
+
+	private:
+		const FlatHashMap* map;
+		size_t slot;
+	};
+
+public:
+	size_t size() const { return count; }
+	bool empty() const { return count == 0; }
+	const_iterator begin() const { return const_iterator(this, 0); }
+	const_iterator end() const { return const_iterator(this, used.size()); }
+
+	const_iterator find(const Key& key) const
+	{
+		if (count == 0)
+			return end();
+		size_t slot = FindSlot(key);
+		return used[slot] ? const_iterator(this, slot) : end();
+	}
+
+	// Leaves the value of a key already there unchanged, like std::unordered_map.
+	bool insert(const value_type& entry)
+	{
+		Reserve(count + 1);
+		size_t slot = FindSlot(entry.first);
+		if (used[slot])
+			return false;
+
+		slots[slot] = entry;
+		used[slot] = true;
+		++count;
+		return true;
+	}
+
+	Value& operator[](const Key& key)
+	{
+		Reserve(count + 1);
+		size_t slot = FindSlot(key);
+		if (!used[slot])
+		{
+			slots[slot] = value_type(key, Value());
+			used[slot] = true;
+			++count;
+		}
+		return slots[slot].second;
+	}
+
+	size_t erase(const Key& key)
+	{
+		if (count == 0)
+			return 0;
+		size_t slot = FindSlot(key);
+		if (!used[slot])
+			return 0;
+
+		// An entry can fill the hole if its own slot is not between the hole and it.
+		size_t mask = slots.size() - 1;
+		for (size_t next = (slot + 1) & mask; used[next]; next = (next + 1) & mask)
+		{
+			size_t home = hasher(slots[next].first) & mask;
+			if (((next - home) & mask) >= ((next - slot) & mask))
+			{
+				slots[slot] = std::move(slots[next]);
+				slot = next;
+			}
+		}
+
+		slots[slot] = value_type();
+		used[slot] = false;
+		--count;
+		return 1;
+	}
+
+	// Makes room for numberOfEntries entries in all, so that inserting them does not rehash.
+	void reserve(size_t numberOfEntries)
+	{
+		Reserve(numberOfEntries);
+	}
+
+	void clear()
+	{
+		slots.clear();
+		used.clear();
+		count = 0;
+	}
+
+	// The slots that looking up the key reads, whether it is there or not; 1 for a key in its own slot.
+	size_t GetProbeLength(const Key& key) const
+	{
+		if (count == 0)
+			return 0;
+		size_t mask = slots.size() - 1;
+		size_t slot = hasher(key) & mask, length = 1;
+		for (; used[slot] && !(slots[slot].first == key); slot = (slot + 1) & mask)
+			++length;
+		return length;
+	}
+
+private:
+	// The slot of the key, or the empty slot where it would go.
+	size_t FindSlot(const Key& key) const
+	{
+		size_t mask = slots.size() - 1;
+		size_t slot = hasher(key) & mask;
+		while (used[slot] && !(slots[slot].first == key))
+			slot = (slot + 1) & mask;
+		return slot;
+	}
+
+	// At most 3/4 of the slots are used, so probes stay short.
+	void Reserve(size_t numberOfEntries)
+	{
+		if (numberOfEntries * 4 <= slots.size() * 3)
+			return;
+
+		size_t capacity = slots.empty() ? 16 : slots.size() * 2;
+		while (numberOfEntries * 4 > capacity * 3)
+			capacity *= 2;
+
+		std::vector<value_type> oldSlots(capacity);
+		std::vector<bool> oldUsed(capacity, false);
+		oldSlots.swap(slots);
+		oldUsed.swap(used);
+
+		size_t mask = capacity - 1;
+		for (size_t slot = 0; slot < oldSlots.size(); ++slot)
+		{
+			if (!oldUsed[slot])
+				continue;
+			size_t newSlot = hasher(oldSlots[slot].first) & mask;
+			while (used[newSlot])
+				newSlot = (newSlot + 1) & mask;
+			slots[newSlot] = std::move(oldSlots[slot]);
+			used[newSlot] = true;
+		}
+	}
+
+private:
+	std::vector<value_type> slots;
+	std::vector<bool> used;
+	size_t count = 0;
+	Hasher hasher;
+};
@@ -0,0 +1,188 @@
+#include "LazyDFA.h"
+#include <algorithm>
+
+namespace
+{
+	// Rough cost of a hash map node besides the subset it holds.
+	constexpr size_t nodeOverhead = 4 * sizeof(void*);
+}
+
+LazyDFA::LazyDFA(const NFA& NFA, size_t memoryLimit) :
+	LazyDFA(CompiledNFA(NFA), memoryLimit)
+{
+}
+
+LazyDFA::LazyDFA(const CompiledNFA& compiledNFA, size_t memoryLimit) :
+	compiledNFA(compiledNFA),
+	memoryLimit(memoryLimit),
+	marked(compiledNFA.GetNumberOfStates(), false)
+{
+}
+
+// O(l) once the subsets the word goes through are cached, l = word.length()
+bool LazyDFA::Accepts(const std::string& word)
+{
+	if (compiledNFA.GetNumberOfStates() == 0)
+		return false;
+
+	if (initialState == unknown)
+		initialState = GetState(Subset(1, compiledNFA.GetInitialState()));
+
+	const size_t numberOfClasses = compiledNFA.GetNumberOfClasses();
+	Index currState = initialState;
+	size_t lastReset = 0, misses = 0;
+	for (size_t index = 0; index < word.size(); ++index)
+	{
+		CompiledNFA::SymbolClass symbolClass = compiledNFA.GetSymbolClass(word[index]);
+		Index nextState = transitions[currState * numberOfClasses + symbolClass];
+		if (nextState == unknown)
+		{
+			size_t resets = numberOfResets;
+			nextState = GetNextState(currState, symbolClass, word[index]);
+			++misses;
+			if (numberOfResets != resets)
+			{
+				if (index + 1 - lastReset < symbolsPerMiss * misses)
+				{
+					++numberOfFallbacks;
+					return Simulate(*subsets[nextState], word, index + 1);
+				}
+				lastReset = index + 1;
+				misses = 0;
+			}
+		}
+		if (nextState == dead)
+			return false;
+		currState = nextState;
+	}
+
+	return finalStates[currState];
+}
+
+void LazyDFA::Reset()
+{
+	indices.clear();
+	subsets.clear();
+	finalStates.clear();
+	transitions.clear();
+	initialState = unknown;
+	memoryUsage = 0;
+}
+
+size_t LazyDFA::GetNumberOfStates() const
+{
+	return subsets.size();
+}
+
+size_t LazyDFA::GetNumberOfResets() const
+{
+	return numberOfResets;
+}
+
+size_t LazyDFA::GetNumberOfFallbacks() const
+{
+	return numberOfFallbacks;
+}
+
+size_t LazyDFA::GetMemoryUsage() const
+{
+	return memoryUsage;
+}
+
+size_t LazyDFA::GetMemoryLimit() const
+{
+	return memoryLimit;
+}
+
+// The subset has to be sorted.
+LazyDFA::Index LazyDFA::GetState(Subset&& subset)
+{
+	const auto& it = indices.find(subset);
+	if (it != indices.end())
+		return it->second;
+
+	size_t numberOfClasses = compiledNFA.GetNumberOfClasses();
+	Index state = static_cast<Index>(subsets.size());
+	bool final = false;
+	for (const auto& nfaState : subset)
+		final = final || compiledNFA.IsFinal(nfaState);
+
+	memoryUsage += nodeOverhead + sizeof(Subset) + subset.size() * sizeof(StateId) +
+		sizeof(const Subset*) + numberOfClasses * sizeof(Index);
+
+	const auto& inserted = indices.emplace(std::move(subset), state).first;
+	subsets.push_back(&inserted->first);
+	finalStates.push_back(final);
+	transitions.resize(transitions.size() + numberOfClasses, unknown);
+	return state;
+}
+
+// When the cache has no room for the next subset, it is cleared first and the transition
+// that led there is not recorded.
+LazyDFA::Index LazyDFA::GetNextState(Index currState, CompiledNFA::SymbolClass symbolClass, char character)
+{
+	Subset nextSubset;
+	for (const auto& state : *subsets[currState])
+	{
+		CompiledNFA::Targets transition = compiledNFA.GetTransitions(state, character);
+		for (const StateId* nextState = transition.first; nextState != transition.second; ++nextState)
+			if (!marked[*nextState])
+			{
+				marked[*nextState] = true;
+				nextSubset.push_back(*nextState);
+			}
+	}
+	for (const auto& state : nextSubset)
+		marked[state] = false;
+
+	size_t cell = currState * compiledNFA.GetNumberOfClasses() + symbolClass;
+	if (nextSubset.empty())
+	{
+		transitions[cell] = dead;
+		return dead;
+	}
+
+	std::sort(nextSubset.begin(), nextSubset.end());
+	if (indices.find(nextSubset) == indices.end() && memoryUsage >= memoryLimit)
+	{
+		Reset();
+		++numberOfResets;
+		return GetState(std::move(nextSubset));
+	}
+
+	Index nextState = GetState(std::move(nextSubset));
+	transitions[cell] = nextState;
+	return nextState;
+}
+
+// Continues the word from the given subset as CompiledNFA::Accepts does, without the cache.
+bool LazyDFA::Simulate(Subset currStates, const std::string& word, size_t index)
+{
+	Subset nextStates;
+	for (; index < word.size(); ++index)
+	{
+		nextStates.clear();
+		for (const auto& state : currStates)
+		{
+			CompiledNFA::Targets transition = compiledNFA.GetTransitions(state, word[index]);
+			for (const StateId* nextState = transition.first; nextState != transition.second; ++nextState)
+				if (!marked[*nextState])
+				{
+					marked[*nextState] = true;
+					nextStates.push_back(*nextState);
+				}
+		}
+
+		if (nextStates.empty())
+			return false;
+
+		for (const auto& state : nextStates)
+			marked[state] = false;
+		currStates.swap(nextStates);
+	}
+
+	for (const auto& state : currStates)
+		if (compiledNFA.IsFinal(state))
+			return true;
+	return false;
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "CompiledNFA.h"
+#include <unordered_map>
+#include <vector>
+
+// Matches on an NFA through the DFA of its subsets, built only as far as the words need
+// it: each subset reached and each transition taken between subsets is cached, so words
+// that stay on known paths run one table lookup per symbol. The cache is kept under a
+// memory limit; when it is full it is cleared and rebuilt from the current subset. If a
+// word keeps filling it, that is, fewer than symbolsPerMiss symbols are matched from the
+// cache per subset computed, the rest of the word is matched on the NFA directly.
+class LazyDFA
+{
+public:
+	static constexpr size_t defaultMemoryLimit = size_t(16) << 20;
+	static constexpr size_t symbolsPerMiss = 10;
+
+public:
+	explicit LazyDFA(const NFA&, size_t memoryLimit = defaultMemoryLimit);
+	explicit LazyDFA(const CompiledNFA&, size_t memoryLimit = defaultMemoryLimit);
+
+	bool Accepts(const std::string&);
+	void Reset();
+
+	size_t GetNumberOfStates() const;
+	size_t GetNumberOfResets() const;
+	size_t GetNumberOfFallbacks() const;
+	size_t GetMemoryUsage() const;
+	size_t GetMemoryLimit() const;
+
+private:
+	using StateId = CompiledNFA::StateId;
+	using Subset = std::vector<StateId>;
+	using Index = uint32_t;
+
+	static constexpr Index unknown = UINT32_MAX;
+	static constexpr Index dead = UINT32_MAX - 1;
+
+	Index GetState(Subset&&);
+	Index GetNextState(Index, CompiledNFA::SymbolClass, char);
+	bool Simulate(Subset, const std::string&, size_t);
+
+private:
+	CompiledNFA compiledNFA;
+	size_t memoryLimit;
+	size_t memoryUsage = 0;
+	size_t numberOfResets = 0;
+	size_t numberOfFallbacks = 0;
+
+	std::unordered_map<Subset, Index, SubsetHash> indices;
+	// Indexed by cached state.
+	std::vector<const Subset*> subsets;
+	std::vector<bool> finalStates;
+	// transitions[state * number of classes + symbol class], unknown until taken once
+	std::vector<Index> transitions;
+	Index initialState = unknown;
+
+	std::vector<bool> marked;
+};
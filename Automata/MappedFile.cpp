@@ -0,0 +1,139 @@
+#include "MappedFile.h"
+#include <utility>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+MappedFile::MappedFile(const std::string& fileName)
+{
+	file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		file = nullptr;
+		return;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize))
+	{
+		Close();
+		return;
+	}
+
+	size = static_cast<size_t>(fileSize.QuadPart);
+	isOpen = true;
+	if (size == 0)
+		return;
+
+	mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping)
+		data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+	if (!data)
+		Close();
+}
+
+void MappedFile::Close()
+{
+	if (data)
+		UnmapViewOfFile(data);
+	if (mapping)
+		CloseHandle(mapping);
+	if (file)
+		CloseHandle(file);
+
+	isOpen = false;
+	data = nullptr;
+	size = 0;
+	mapping = nullptr;
+	file = nullptr;
+}
+#else
+MappedFile::MappedFile(const std::string& fileName)
+{
+	int descriptor = open(fileName.c_str(), O_RDONLY);
+	if (descriptor < 0)
+		return;
+
+	struct stat status;
+	if (fstat(descriptor, &status) == 0)
+	{
+		size = static_cast<size_t>(status.st_size);
+		isOpen = true;
+		if (size != 0)
+		{
+			void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+			if (address != MAP_FAILED)
+			{
+				madvise(address, size, MADV_SEQUENTIAL);
+				data = static_cast<const char*>(address);
+			}
+			else
+			{
+				isOpen = false;
+				size = 0;
+			}
+		}
+	}
+
+	close(descriptor);
+}
+
+void MappedFile::Close()
+{
+	if (data)
+		munmap(const_cast<char*>(data), size);
+
+	isOpen = false;
+	data = nullptr;
+	size = 0;
+}
+#endif
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+	*this = std::move(other);
+}
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+	if (this != &other)
+	{
+		Close();
+		std::swap(isOpen, other.isOpen);
+		std::swap(data, other.data);
+		std::swap(size, other.size);
+#ifdef _WIN32
+		std::swap(file, other.file);
+		std::swap(mapping, other.mapping);
+#endif
+	}
+	return *this;
+}
+
+bool MappedFile::IsOpen() const
+{
+	return isOpen;
+}
+
+const char* MappedFile::GetData() const
+{
+	return data;
+}
+
+size_t MappedFile::GetSize() const
+{
+	return size;
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+
+class MappedFile
+{
+public:
+	MappedFile() = default;
+	explicit MappedFile(const std::string&);
+	MappedFile(const MappedFile&) = delete;
+	MappedFile(MappedFile&&) noexcept;
+	~MappedFile();
+
+	MappedFile& operator=(const MappedFile&) = delete;
+	MappedFile& operator=(MappedFile&&) noexcept;
+
+	bool IsOpen() const;
+	const char* GetData() const;
+	size_t GetSize() const;
+
+private:
+	void Close();
+
+private:
+	bool isOpen = false;
+	const char* data = nullptr;
+	size_t size = 0;
+#ifdef _WIN32
+	void* file = nullptr;
+	void* mapping = nullptr;
+#endif
+};
@@ -0,0 +1,747 @@
+#include "Minimization.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <queue>
+
+namespace
+{
+	// For keys that are hashes already.
+	struct IdentityHash
+	{
+		size_t operator()(uint64_t key) const
+		{
+			return static_cast<size_t>(key);
+		}
+	};
+}
+
+Minimization::Minimization(std::ostream* trace, size_t numberOfThreads) :
+	trace(trace),
+	numberOfThreads(numberOfThreads)
+{
+}
+
+MinimizationReport Minimization::Minimize(DFA& DFA, MinimizationAlgorithm algorithm, std::ostream* trace, size_t numberOfThreads)
+{
+	Minimization minimization(trace, numberOfThreads);
+	return minimization.Run(DFA, algorithm);
+}
+
+MinimizationReport Minimization::TableFillingMethod(DFA& otherDFA)
+{
+	return Run(otherDFA, MinimizationAlgorithm::TableFilling);
+}
+
+MinimizationReport Minimization::HopcroftMethod(DFA& otherDFA)
+{
+	return Run(otherDFA, MinimizationAlgorithm::Hopcroft);
+}
+
+MinimizationReport Minimization::ParallelRefinementMethod(DFA& otherDFA)
+{
+	return Run(otherDFA, MinimizationAlgorithm::ParallelRefinement);
+}
+
+// Every method removes the unreachable states and completes the DFA with a trap state, then
+// finds the classes either by filling the table of pairs or by refining a partition.
+MinimizationReport Minimization::Run(DFA& otherDFA, MinimizationAlgorithm algorithm)
+{
+	MinimizationReport report;
+	report.numberOfStates = otherDFA.GetStates().size();
+	auto start = std::chrono::steady_clock::now();
+	auto lap = [&start]()
+	{
+		auto now = std::chrono::steady_clock::now();
+		double seconds = std::chrono::duration<double>(now - start).count();
+		start = now;
+		return seconds;
+	};
+
+	Reset();
+	dfa = std::move(otherDFA);
+
+	FindUnreachableStates();
+	report.unreachableStates = unreachableStates.size();
+	if (!unreachableStates.empty())
+	{
+		RemoveUnreachableStates();
+		if (trace)
+		{
+			*trace << "Unreachable states: ";
+			for (const auto& state : unreachableStates)
+				*trace << dfa.GetStateName(state) << ", ";
+			*trace << "\b\b \n";
+
+			*trace << "Removed unreachable states: \n";
+			dfa.Print(*trace);
+		}
+	}
+	report.reachabilityTime = lap();
+
+	// With no initial state no state is reachable, and the minimal DFA is the empty one.
+	if (dfa.GetInitialState() == DFA::noState)
+	{
+		otherDFA = DFA();
+		return report;
+	}
+
+	if (dfa.GetStates().size() * dfa.GetSymbols().size() != dfa.GetTransitionTable().size())
+	{
+		AddTrapState();
+		report.trapState = true;
+		if (trace)
+		{
+			*trace << "The DFA after adding the trap state: \n";
+			dfa.Print(*trace);
+		}
+	}
+	report.completionTime = lap();
+
+	IndexStates(algorithm != MinimizationAlgorithm::ParallelRefinement);
+	if (algorithm == MinimizationAlgorithm::Hopcroft)
+		RefinePartition();
+	else if (algorithm == MinimizationAlgorithm::ParallelRefinement)
+		RefineSignatures();
+	else
+	{
+		ConstructPairTable();
+		if (trace)
+		{
+			*trace << "The table of unmarked pairs: \n";
+			PrintPairTable();
+			*trace << "The table of marked pairs: \n";
+		}
+		MarkPairs();
+		ConstructEquivalenceClasses();
+	}
+	report.numberOfClasses = equivalenceClasses.size();
+	report.numberOfIterations = numberOfIterations;
+	if (trace)
+	{
+		*trace << "Equivalence classes: \n";
+		PrintEquivalenceClasses();
+	}
+	report.refinementTime = lap();
+
+	otherDFA = GetNewDFA();
+	report.constructionTime = lap();
+	return report;
+}
+
+// Drops what is left of the last run, so that one Minimization can minimize many DFAs.
+void Minimization::Reset()
+{
+	numberOfIterations = 0;
+	unreachableStates.clear();
+	ids.clear();
+	numberOfSymbols = 0;
+	targets.clear();
+	offsets.clear();
+	predecessors.clear();
+	pairTable = PairTable();
+	newStates.clear();
+	equivalenceClasses.clear();
+}
+
+void Minimization::FindUnreachableStates()
+{
+	std::vector<bool> reachableStates;
+	std::queue<DFA::StateId> queue;
+
+	auto reach = [&reachableStates, &queue](DFA::StateId state)
+		{
+			if (state >= reachableStates.size())
+				reachableStates.resize(state + 1, false);
+			if (reachableStates[state])
+				return;
+
+			reachableStates[state] = true;
+			queue.push(state);
+		};
+
+	if (dfa.GetInitialState() != DFA::noState)
+		reach(dfa.GetInitialState());
+	while (!queue.empty())
+	{
+		DFA::StateId currState = queue.front();
+		queue.pop();
+
+		for (const auto& symbol : dfa.GetSymbols())
+		{
+			DFA::StateId nextState = dfa.GetTransition(currState, symbol);
+			if (nextState != DFA::noState)
+				reach(nextState);
+		}
+	}
+
+	for (const auto& state : dfa.GetStates())
+		if (state >= reachableStates.size() || !reachableStates[state])
+			unreachableStates.push_back(state);
+}
+
+void Minimization::RemoveUnreachableStates()
+{
+	dfa.RemoveStates(unreachableStates);
+	for (const auto& state : unreachableStates)
+		for (const auto& symbol : dfa.GetSymbols())
+			dfa.RemoveTransition(state, symbol);
+}
+
+void Minimization::AddTrapState()
+{
+	size_t number = dfa.GetStates().size();
+	while (dfa.GetStates().Contains(dfa.GetStateId("q" + std::to_string(number))))
+		++number;
+	DFA::StateId newState = dfa.InsertState("q" + std::to_string(number));
+
+	for (const auto& state : dfa.GetStates())
+	{
+		for (const auto& symbol : dfa.GetSymbols())
+		{
+			if (dfa.GetTransition(state, symbol) == DFA::noState)
+				dfa.InsertTransition(std::make_pair(state, symbol), newState);
+		}
+	}
+}
+
+// Numbers the states by their order in the DFA and keeps the transitions, and also the
+// inverse ones if asked.
+void Minimization::IndexStates(bool withPredecessors)
+{
+	ids.assign(dfa.GetStates().begin(), dfa.GetStates().end());
+	std::vector<DFA::Symbol> symbols(dfa.GetSymbols().begin(), dfa.GetSymbols().end());
+	uint32_t numberOfStates = static_cast<uint32_t>(ids.size());
+	numberOfSymbols = symbols.size();
+	if (numberOfStates == 0)
+		return;
+
+	std::vector<uint32_t> indices(*std::max_element(ids.begin(), ids.end()) + 1);
+	for (uint32_t index = 0; index < numberOfStates; ++index)
+		indices[ids[index]] = index;
+
+	targets.resize(numberOfStates * numberOfSymbols);
+	ParallelFor(numberOfStates, withPredecessors ? 1 : numberOfThreads, [&](size_t begin, size_t end)
+		{
+			for (size_t state = begin; state < end; ++state)
+				for (size_t symbol = 0; symbol < numberOfSymbols; ++symbol)
+					targets[state * numberOfSymbols + symbol] = indices[dfa.GetTransition(ids[state], symbols[symbol])];
+		});
+	if (!withPredecessors)
+		return;
+
+	offsets.assign(numberOfSymbols * numberOfStates + 1, 0);
+	for (uint32_t state = 0; state < numberOfStates; ++state)
+		for (size_t symbol = 0; symbol < numberOfSymbols; ++symbol)
+			++offsets[symbol * numberOfStates + targets[state * numberOfSymbols + symbol] + 1];
+	for (size_t index = 1; index < offsets.size(); ++index)
+		offsets[index] += offsets[index - 1];
+
+	predecessors.resize(offsets.back());
+	std::vector<uint32_t> filled(offsets.begin(), offsets.end() - 1);
+	for (uint32_t state = 0; state < numberOfStates; ++state)
+		for (size_t symbol = 0; symbol < numberOfSymbols; ++symbol)
+			predecessors[filled[symbol * numberOfStates + targets[state * numberOfSymbols + symbol]]++] = state;
+}
+
+void Minimization::ConstructPairTable()
+{
+	pairTable = PairTable(ids.size());
+}
+
+void Minimization::PrintPairTable()
+{
+	for (uint32_t state1 = 0; state1 < ids.size(); ++state1)
+	{
+		for (uint32_t state2 = 0; state2 < state1; ++state2)
+			*trace << "(" << dfa.GetStateName(ids[state1]) << dfa.GetStateName(ids[state2]) << ", " << pairTable.IsMarked(state1, state2) << ") ";
+
+		*trace << std::endl;
+	}
+	*trace << std::endl;
+}
+
+// A pair is marked when its states are told apart by a word. Only the pairs going into a
+// newly marked pair can be marked after it, so each marked pair also waits in a second table
+// until the pairs going into it are found from the inverse transitions; a sweep takes the
+// waiting pairs in the order of the table, and pairs marked behind it wait for the next one.
+void Minimization::MarkPairs()
+{
+	uint32_t numberOfStates = static_cast<uint32_t>(ids.size());
+	PairTable pending(numberOfStates);
+	size_t numberOfPending = 0;
+	for (uint32_t state1 = 0; state1 < numberOfStates; ++state1)
+		for (uint32_t state2 = 0; state2 < state1; ++state2)
+			if (dfa.GetFinalStates().Contains(ids[state1]) != dfa.GetFinalStates().Contains(ids[state2]))
+			{
+				pairTable.Mark(state1, state2);
+				pending.Mark(state1, state2);
+				++numberOfPending;
+			}
+
+	if (trace)
+	{
+		*trace << "The table after marking all of (P,F) pairs: \n";
+		PrintPairTable();
+	}
+
+	do
+	{
+		uint32_t state1, state2;
+		for (size_t index = 0; numberOfPending != 0 && pending.TakeNext(index, state1, state2); --numberOfPending)
+			for (size_t symbol = 0; symbol < numberOfSymbols; ++symbol)
+			{
+				size_t first1 = offsets[symbol * numberOfStates + state1], last1 = offsets[symbol * numberOfStates + state1 + 1];
+				size_t first2 = offsets[symbol * numberOfStates + state2], last2 = offsets[symbol * numberOfStates + state2 + 1];
+				for (size_t index1 = first1; index1 < last1; ++index1)
+					for (size_t index2 = first2; index2 < last2; ++index2)
+					{
+						uint32_t previousState1 = predecessors[index1], previousState2 = predecessors[index2];
+						if (previousState1 < previousState2)
+							std::swap(previousState1, previousState2);
+						if (pairTable.Mark(previousState1, previousState2))
+						{
+							pending.Mark(previousState1, previousState2);
+							++numberOfPending;
+						}
+					}
+			}
+
+		++numberOfIterations;
+		if (trace)
+		{
+			*trace << "Iteration " << numberOfIterations << ": \n";
+			PrintPairTable();
+		}
+
+	} while (numberOfPending != 0);
+}
+
+void Minimization::ConstructEquivalenceClasses()
+{
+	std::vector<bool> classified(ids.size(), false);
+	for (uint32_t state2 = 0; state2 < ids.size(); ++state2)
+	{
+		if (classified[state2])
+			continue;
+
+		std::vector<DFA::StateId> temp(1, ids[state2]);
+		newStates.insert(std::make_pair(ids[state2], equivalenceClasses.size()));
+		for (uint32_t state1 = state2 + 1; state1 < ids.size(); ++state1)
+		{
+			if (!pairTable.IsMarked(state1, state2))
+			{
+				classified[state1] = true;
+				temp.push_back(ids[state1]);
+				newStates.insert(std::make_pair(ids[state1], equivalenceClasses.size()));
+			}
+		}
+		equivalenceClasses.push_back(std::move(temp));
+	}
+}
+
+// Hopcroft's algorithm, on the states numbered by their order in the DFA. The partition
+// starts as the final and the other states, and a block B is split by a splitter (A, a)
+// into the states that go into A on a and the others. When a split block was waiting to be
+// a splitter both halves wait; otherwise only the smaller one needs to, so a state is in a
+// splitter at most log n times. The classes come out in the same order as from the table.
+void Minimization::RefinePartition()
+{
+	uint32_t numberOfStates = static_cast<uint32_t>(ids.size());
+	if (numberOfStates == 0)
+		return;
+
+	// Block b is elements[first[b]..last[b]), its marked states at the front.
+	std::vector<uint32_t> elements, locations(numberOfStates), blocks(numberOfStates);
+	std::vector<uint32_t> first, last, marked;
+	for (bool final : { true, false })
+	{
+		uint32_t block = static_cast<uint32_t>(first.size());
+		size_t begin = elements.size();
+		for (uint32_t state = 0; state < numberOfStates; ++state)
+			if (dfa.GetFinalStates().Contains(ids[state]) == final)
+			{
+				locations[state] = static_cast<uint32_t>(elements.size());
+				blocks[state] = block;
+				elements.push_back(state);
+			}
+		if (elements.size() != begin)
+		{
+			first.push_back(static_cast<uint32_t>(begin));
+			last.push_back(static_cast<uint32_t>(elements.size()));
+			marked.push_back(0);
+		}
+	}
+
+	std::vector<std::pair<uint32_t, uint32_t>> splitters;
+	std::vector<bool> waiting(first.size() * numberOfSymbols, false);
+	auto wait = [this, &splitters, &waiting](uint32_t block, size_t symbol)
+	{
+		waiting[block * numberOfSymbols + symbol] = true;
+		splitters.emplace_back(block, static_cast<uint32_t>(symbol));
+	};
+	uint32_t smallest = first.size() == 2 && last[1] - first[1] < last[0] - first[0] ? 1 : 0;
+	for (size_t symbol = 0; symbol < numberOfSymbols; ++symbol)
+		wait(smallest, symbol);
+
+	std::vector<uint32_t> splitter, touched;
+	while (!splitters.empty())
+	{
+		auto [block, symbol] = splitters.back();
+		splitters.pop_back();
+		++numberOfIterations;
+		waiting[block * numberOfSymbols + symbol] = false;
+
+		splitter.assign(elements.begin() + first[block], elements.begin() + last[block]);
+		for (const auto& target : splitter)
+			for (uint32_t index = offsets[symbol * numberOfStates + target]; index < offsets[symbol * numberOfStates + target + 1]; ++index)
+			{
+				uint32_t state = predecessors[index];
+				uint32_t split = blocks[state];
+				uint32_t position = first[split] + marked[split];
+				if (locations[state] < position)
+					continue;
+				if (marked[split] == 0)
+					touched.push_back(split);
+
+				uint32_t other = elements[position];
+				std::swap(elements[position], elements[locations[state]]);
+				locations[other] = locations[state];
+				locations[state] = position;
+				++marked[split];
+			}
+
+		for (const auto& split : touched)
+		{
+			uint32_t size = last[split] - first[split];
+			uint32_t numberOfMarked = marked[split];
+			marked[split] = 0;
+			if (numberOfMarked == size)
+				continue;
+
+			uint32_t newBlock = static_cast<uint32_t>(first.size());
+			first.push_back(first[split]);
+			last.push_back(first[split] + numberOfMarked);
+			marked.push_back(0);
+			first[split] += numberOfMarked;
+			for (uint32_t position = first[newBlock]; position < last[newBlock]; ++position)
+				blocks[elements[position]] = newBlock;
+
+			waiting.resize(first.size() * numberOfSymbols, false);
+			for (size_t nextSymbol = 0; nextSymbol < numberOfSymbols; ++nextSymbol)
+			{
+				if (waiting[split * numberOfSymbols + nextSymbol])
+					wait(newBlock, nextSymbol);
+				else
+					wait(numberOfMarked <= size - numberOfMarked ? newBlock : split, nextSymbol);
+			}
+		}
+		touched.clear();
+	}
+
+	ConstructEquivalenceClasses(blocks);
+}
+
+// Moore's algorithm: the classes start as the final and the other states, and in every
+// round a state's signature is its class and the classes of its targets. A new class is
+// named after its first state, so the classes do not depend on the threads. Every step of
+// a round runs on all threads: the signatures are hashed; the states are split into parts
+// by their hash, each part keeping the order of the states, and each part is grouped by its
+// own hash table; then every state is checked to have the signature of the state that names
+// its class. Only if two signatures had the same hash is the round grouped again, on one
+// thread, comparing the signatures whose hashes are equal. The rounds end when one leaves
+// the number of classes alone.
+void Minimization::RefineSignatures()
+{
+	uint32_t numberOfStates = static_cast<uint32_t>(ids.size());
+	if (numberOfStates == 0)
+		return;
+
+	std::vector<uint32_t> classes(numberOfStates), nextClasses(numberOfStates);
+	bool hasFinal = false, hasOther = false;
+	for (uint32_t state = 0; state < numberOfStates; ++state)
+	{
+		bool final = dfa.GetFinalStates().Contains(ids[state]);
+		hasFinal = hasFinal || final;
+		hasOther = hasOther || !final;
+		classes[state] = final;
+	}
+	size_t numberOfClasses = size_t(hasFinal) + hasOther;
+
+	auto sameSignature = [this, &classes](uint32_t state1, uint32_t state2)
+	{
+		if (classes[state1] != classes[state2])
+			return false;
+		for (size_t symbol = 0; symbol < numberOfSymbols; ++symbol)
+			if (classes[targets[state1 * numberOfSymbols + symbol]] != classes[targets[state2 * numberOfSymbols + symbol]])
+				return false;
+		return true;
+	};
+
+	// The states of part p go from p * numberOfStates / numberOfParts, and those of a hash go
+	// to the part given by its high bits; the low ones are left to the hash tables.
+	const size_t numberOfParts = std::min<size_t>(GetNumberOfThreads(numberOfThreads), numberOfStates);
+	auto getFirstState = [numberOfStates, numberOfParts](size_t part)
+	{
+		return static_cast<uint32_t>(part * numberOfStates / numberOfParts);
+	};
+	auto getPart = [numberOfParts](uint64_t hash)
+	{
+		return static_cast<size_t>((hash >> 32) * numberOfParts >> 32);
+	};
+
+	std::vector<uint64_t> signatures(numberOfStates);
+	// counts[p * numberOfParts + q] is the number of the states of part p whose hash goes to
+	// part q, then where the first of them goes in order.
+	std::vector<size_t> counts(numberOfParts * numberOfParts);
+	std::vector<uint32_t> order(numberOfStates);
+	std::vector<size_t> partOffsets(numberOfParts + 1);
+	// The first state of every new class, by the hash of its signature.
+	std::vector<FlatHashMap<uint64_t, uint32_t, IdentityHash>> representatives(numberOfParts);
+	std::vector<size_t> partClasses(numberOfParts);
+	std::vector<char> partCollisions(numberOfParts);
+	while (true)
+	{
+		++numberOfIterations;
+		ParallelFor(numberOfParts, numberOfParts, [&](size_t firstPart, size_t lastPart)
+			{
+				Hash hash;
+				for (size_t part = firstPart; part < lastPart; ++part)
+				{
+					std::fill(counts.begin() + part * numberOfParts, counts.begin() + (part + 1) * numberOfParts, 0);
+					for (uint32_t state = getFirstState(part); state < getFirstState(part + 1); ++state)
+					{
+						uint64_t signature = hash(std::make_pair(classes[state], numberOfSymbols));
+						for (size_t symbol = 0; symbol < numberOfSymbols; ++symbol)
+							signature = hash(std::make_pair(signature, classes[targets[state * numberOfSymbols + symbol]]));
+						signatures[state] = signature;
+						++counts[part * numberOfParts + getPart(signature)];
+					}
+				}
+			});
+
+		size_t position = 0;
+		for (size_t hashPart = 0; hashPart < numberOfParts; ++hashPart)
+		{
+			partOffsets[hashPart] = position;
+			for (size_t part = 0; part < numberOfParts; ++part)
+			{
+				size_t count = counts[part * numberOfParts + hashPart];
+				counts[part * numberOfParts + hashPart] = position;
+				position += count;
+			}
+		}
+		partOffsets[numberOfParts] = position;
+
+		ParallelFor(numberOfParts, numberOfParts, [&](size_t firstPart, size_t lastPart)
+			{
+				for (size_t part = firstPart; part < lastPart; ++part)
+					for (uint32_t state = getFirstState(part); state < getFirstState(part + 1); ++state)
+						order[counts[part * numberOfParts + getPart(signatures[state])]++] = state;
+			});
+
+		ParallelFor(numberOfParts, numberOfParts, [&](size_t firstPart, size_t lastPart)
+			{
+				for (size_t part = firstPart; part < lastPart; ++part)
+				{
+					auto& firstStates = representatives[part];
+					firstStates.clear();
+					for (size_t index = partOffsets[part]; index < partOffsets[part + 1]; ++index)
+					{
+						uint32_t state = order[index];
+						const auto& it = firstStates.find(signatures[state]);
+						if (it != firstStates.end())
+							nextClasses[state] = it->second;
+						else
+						{
+							firstStates.insert(std::make_pair(signatures[state], state));
+							nextClasses[state] = state;
+						}
+					}
+				}
+			});
+
+		ParallelFor(numberOfParts, numberOfParts, [&](size_t firstPart, size_t lastPart)
+			{
+				for (size_t part = firstPart; part < lastPart; ++part)
+				{
+					partClasses[part] = 0;
+					partCollisions[part] = false;
+					for (uint32_t state = getFirstState(part); state < getFirstState(part + 1); ++state)
+					{
+						if (nextClasses[state] == state)
+							++partClasses[part];
+						else if (!sameSignature(nextClasses[state], state))
+							partCollisions[part] = true;
+					}
+				}
+			});
+
+		size_t nextNumberOfClasses = 0;
+		bool collision = false;
+		for (size_t part = 0; part < numberOfParts; ++part)
+		{
+			nextNumberOfClasses += partClasses[part];
+			collision = collision || partCollisions[part];
+		}
+
+		if (collision)
+		{
+			// A different signature with the same hash goes on to the next key.
+			FlatHashMap<uint64_t, uint32_t, IdentityHash> firstStates;
+			nextNumberOfClasses = 0;
+			for (uint32_t state = 0; state < numberOfStates; ++state)
+				for (uint64_t key = signatures[state]; ; ++key)
+				{
+					const auto& it = firstStates.find(key);
+					if (it == firstStates.end())
+					{
+						firstStates.insert(std::make_pair(key, state));
+						nextClasses[state] = state;
+						++nextNumberOfClasses;
+						break;
+					}
+					if (sameSignature(it->second, state))
+					{
+						nextClasses[state] = it->second;
+						break;
+					}
+				}
+		}
+
+		classes.swap(nextClasses);
+		if (nextNumberOfClasses == numberOfClasses)
+			break;
+		numberOfClasses = nextNumberOfClasses;
+	}
+
+	ConstructEquivalenceClasses(classes);
+}
+
+// classes[i] is the class of the state of index i. A class is numbered by its first
+// state, its states in the order of the DFA.
+void Minimization::ConstructEquivalenceClasses(const std::vector<uint32_t>& classes)
+{
+	std::vector<size_t> numbers(*std::max_element(classes.begin(), classes.end()) + 1, SIZE_MAX);
+	for (uint32_t state = 0; state < classes.size(); ++state)
+	{
+		size_t& equivalenceClass = numbers[classes[state]];
+		if (equivalenceClass == SIZE_MAX)
+		{
+			equivalenceClass = equivalenceClasses.size();
+			equivalenceClasses.emplace_back();
+		}
+		equivalenceClasses[equivalenceClass].push_back(ids[state]);
+		newStates.insert(std::make_pair(ids[state], equivalenceClass));
+	}
+}
+
+void Minimization::PrintEquivalenceClasses()
+{
+	for (size_t index = 0; index < equivalenceClasses.size(); ++index)
+		for (const auto& state : equivalenceClasses[index])
+			*trace << dfa.GetStateName(state) << " q" << index << std::endl;
+
+	for (const auto& equivalenceClass : equivalenceClasses)
+	{
+		*trace << "{";
+		for (const auto& state : equivalenceClass)
+		{
+			*trace << dfa.GetStateName(state) << ", ";
+		}
+		*trace << "\b\b} ";
+	}
+	*trace << std::endl << std::endl;
+}
+
+PairTable::PairTable(size_t numberOfStates) :
+	bits(((numberOfStates ? numberOfStates * (numberOfStates - 1) / 2 : 0) + 63) / 64, 0)
+{
+}
+
+bool PairTable::IsMarked(uint32_t state1, uint32_t state2) const
+{
+	size_t index = GetIndex(state1, state2);
+	return bits[index / 64] >> (index % 64) & 1;
+}
+
+// Returns false if the pair was marked already.
+bool PairTable::Mark(uint32_t state1, uint32_t state2)
+{
+	size_t index = GetIndex(state1, state2);
+	uint64_t bit = uint64_t(1) << (index % 64);
+	if (bits[index / 64] & bit)
+		return false;
+	bits[index / 64] |= bit;
+	return true;
+}
+
+// Unmarks the first marked pair from index on and moves index past it; false if there is none.
+bool PairTable::TakeNext(size_t& index, uint32_t& state1, uint32_t& state2)
+{
+	size_t word = index / 64;
+	if (word >= bits.size())
+		return false;
+	uint64_t remaining = bits[word] & (~uint64_t(0) << (index % 64));
+	while (remaining == 0)
+	{
+		if (++word == bits.size())
+		{
+			index = word * 64;
+			return false;
+		}
+		remaining = bits[word];
+	}
+
+	int bit = std::countr_zero(remaining);
+	bits[word] &= ~(uint64_t(1) << bit);
+	index = word * 64 + bit;
+
+	// The row of the index, state1 (state1 - 1) / 2 <= index < (state1 + 1) state1 / 2.
+	state1 = static_cast<uint32_t>((1 + std::sqrt(8.0 * index + 1)) / 2);
+	while (size_t(state1) * (state1 - 1) / 2 > index)
+		--state1;
+	while (size_t(state1 + 1) * state1 / 2 <= index)
+		++state1;
+	state2 = static_cast<uint32_t>(index - size_t(state1) * (state1 - 1) / 2);
+	++index;
+	return true;
+}
+
+// state1 > state2
+size_t PairTable::GetIndex(uint32_t state1, uint32_t state2)
+{
+	return size_t(state1) * (state1 - 1) / 2 + state2;
+}
+
+// The equivalence class i becomes the state qi.
+DFA Minimization::GetNewDFA()
+{
+	DFA minimizedDFA;
+	for (const auto& symbol : dfa.GetSymbols())
+		minimizedDFA.InsertSymbol(symbol);
+
+	std::vector<DFA::StateId> newIds;
+	for (size_t index = 0; index < equivalenceClasses.size(); ++index)
+		newIds.push_back(minimizedDFA.InsertState("q" + std::to_string(index)));
+
+	for (size_t index = 0; index < equivalenceClasses.size(); ++index)
+		for (const auto& oldState : equivalenceClasses[index])
+		{
+			DFA::StateId newState = newIds[index];
+			if (oldState == dfa.GetInitialState())
+				minimizedDFA.SetInitialState(newState);
+			if (dfa.GetFinalStates().Contains(oldState))
+				minimizedDFA.InsertFinalState(newState);
+
+			for (const auto& symbol : dfa.GetSymbols())
+			{
+				DFA::StateId nextState = dfa.GetTransition(oldState, symbol);
+				minimizedDFA.InsertTransition(std::make_pair(newState, symbol), newIds[newStates.at(nextState)]);
+			}
+		}
+
+	return minimizedDFA;
+}
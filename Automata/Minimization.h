@@ -0,0 +1,102 @@
+#pragma once
+#include "DFA.h"
+#include <unordered_set>
+
+// TableFilling marks distinguishable pairs, Hopcroft refines a partition, ParallelRefinement splits classes on all threads.
+enum class MinimizationAlgorithm
+{
+	TableFilling,
+	Hopcroft,
+	ParallelRefinement
+};
+
+// The states before and after, what was removed or added, and the time of each phase in seconds.
+struct MinimizationReport
+{
+	size_t numberOfStates = 0;
+	size_t unreachableStates = 0;
+	bool trapState = false;
+	size_t numberOfClasses = 0;
+	size_t numberOfIterations = 0;
+
+	double reachabilityTime = 0;
+	double completionTime = 0;
+	double refinementTime = 0;
+	double constructionTime = 0;
+};
+
+// One bit for every pair of states, by their indices: the pairs (i, j) with i > j are
+// packed row after row, so n states take n (n - 1) / 2 bits. TakeNext scans them in that order.
+class PairTable
+{
+public:
+	explicit PairTable(size_t numberOfStates = 0);
+
+	bool IsMarked(uint32_t, uint32_t) const;
+	bool Mark(uint32_t, uint32_t);
+	bool TakeNext(size_t& index, uint32_t&, uint32_t&);
+
+private:
+	static size_t GetIndex(uint32_t, uint32_t);
+
+private:
+	std::vector<uint64_t> bits;
+};
+
+class Minimization
+{
+public:
+	using EquivalenceClasses = std::vector<std::vector<DFA::StateId>>;
+
+public:
+	// The steps are traced on trace, if not nullptr. numberOfThreads == 0 uses every hardware thread.
+	explicit Minimization(std::ostream* trace = nullptr, size_t numberOfThreads = 0);
+
+	MinimizationReport TableFillingMethod(DFA&);
+	MinimizationReport HopcroftMethod(DFA&);
+	MinimizationReport ParallelRefinementMethod(DFA&);
+	static MinimizationReport Minimize(DFA&, MinimizationAlgorithm = MinimizationAlgorithm::TableFilling, std::ostream* trace = nullptr,
+		size_t numberOfThreads = 0);
+
+private:
+	MinimizationReport Run(DFA&, MinimizationAlgorithm);
+	void Reset();
+
+	void FindUnreachableStates();
+	void RemoveUnreachableStates();
+
+	void AddTrapState();
+
+	void IndexStates(bool withPredecessors);
+
+	void ConstructPairTable();
+	void PrintPairTable();
+	void MarkPairs();
+
+	void ConstructEquivalenceClasses();
+	void RefinePartition();
+	void RefineSignatures();
+	void ConstructEquivalenceClasses(const std::vector<uint32_t>&);
+	void PrintEquivalenceClasses();
+
+	DFA GetNewDFA();
+
+private:
+	std::ostream* trace;
+	size_t numberOfThreads;
+	size_t numberOfIterations = 0;
+	DFA dfa;
+	std::vector<DFA::StateId> unreachableStates;
+	// The states of the complete DFA in its order, the index of each being its position.
+	std::vector<DFA::StateId> ids;
+	size_t numberOfSymbols = 0;
+	// targets[i * numberOfSymbols + c] is the index reached from i on the symbol c.
+	std::vector<uint32_t> targets;
+	// The indices going into t on c are predecessors[offsets[c * n + t]..offsets[c * n + t + 1]).
+	std::vector<uint32_t> offsets;
+	std::vector<uint32_t> predecessors;
+	PairTable pairTable;
+	std::unordered_map<DFA::StateId, size_t> newStates;
+	EquivalenceClasses equivalenceClasses;
+};
+
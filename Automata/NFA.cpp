@@ -0,0 +1,641 @@
+#include "NFA.h"
+#include "ElementsParser.h"
+#include "Minimization.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <queue>
+
+namespace
+{
+	// About what a node of a hash table takes besides its key and value.
+	constexpr size_t nodeOverhead = 4 * sizeof(void*);
+}
+
+ConversionError::ConversionError(const std::string& message, const ConversionProgress& progress) :
+	std::runtime_error(message),
+	progress(progress)
+{
+}
+
+const ConversionProgress& ConversionError::GetProgress() const
+{
+	return progress;
+}
+
+bool NFA::Verify() const
+{
+	if (!states.Contains(initialState))
+		return false;
+
+	for (const auto& finalState : finalStates)
+		if (!states.Contains(finalState))
+			return false;
+
+	for (const auto& transition : transitionTable)
+	{
+		if (!states.Contains(transition.first.first))
+			return false;
+		if (transition.first.second != lambda && symbols.find(transition.first.second) == symbols.end())
+			return false;
+
+		for (const auto& state : transition.second)
+			if (!states.Contains(state))
+				return false;
+	}
+
+	return true;
+}
+
+// Advances the set of active states one symbol at a time, each state at most once per
+// step, so a word costs O(l * n), l = word.length(), n = number of states. With lambda
+// transitions the set is replaced by its closure after each step.
+bool NFA::Accepts(const std::string& word) const
+{
+	const EpsilonClosures* closures = hasLambdaTransitions ? &GetClosures() : nullptr;
+	std::vector<StateId> currStates(1, initialState), nextStates;
+	if (closures)
+		closures->Close(currStates);
+
+	std::vector<bool> active(stateTable.GetSize(), false);
+	for (const auto& character : word)
+	{
+		if (character == lambda)
+			return false;
+
+		nextStates.clear();
+		for (const auto& state : currStates)
+			for (const auto& nextState : GetTransitions(state, character))
+				if (!active[nextState])
+				{
+					active[nextState] = true;
+					nextStates.push_back(nextState);
+				}
+
+		if (nextStates.empty())
+			return false;
+
+		for (const auto& state : nextStates)
+			active[state] = false;
+		if (closures)
+			closures->Close(nextStates);
+		currStates.swap(nextStates);
+	}
+
+	for (const auto& state : currStates)
+		if (finalStates.Contains(state))
+			return true;
+	return false;
+}
+
+// Prints every path the NFA can take on the word until one of them accepts. The number of
+// paths can grow exponentially with the length of the word, so this is only for debugging.
+bool NFA::Trace(const std::string& word, std::ostream& out) const
+{
+	std::vector<StateId> lambdaPath;
+	return Trace(initialState, word, 0, out, lambdaPath);
+}
+
+// lambdaPath holds the states left through lambda transitions since the last symbol read,
+// which are not entered again.
+bool NFA::Trace(StateId currState, const std::string& word, size_t index, std::ostream& out, std::vector<StateId>& lambdaPath) const
+{
+	if (word.size() == index)
+	{
+		out << "(" << GetStateName(currState) << ", *) -> ";
+		if (finalStates.Contains(currState))
+		{
+			out << "The word is accepted ! \n";
+			return true;
+		}
+	}
+	else
+		out << "(" << GetStateName(currState) << ", " << word.substr(index) << ") -> ";
+
+	bool moved = false;
+	if (index < word.size() && word[index] != lambda)
+		for (const auto& state : GetTransitions(currState, word[index]))
+		{
+			moved = true;
+			std::vector<StateId> nextPath;
+			if (Trace(state, word, index + 1, out, nextPath))
+				return true;
+		}
+
+	lambdaPath.push_back(currState);
+	for (const auto& state : GetTransitions(currState, lambda))
+		if (std::find(lambdaPath.begin(), lambdaPath.end(), state) == lambdaPath.end())
+		{
+			moved = true;
+			if (Trace(state, word, index, out, lambdaPath))
+				return true;
+		}
+	lambdaPath.pop_back();
+
+	if (!moved)
+		out << (word.size() == index ? "The word is not accepted ! \n" : "The NFA has frozen...\n");
+	return false;
+}
+
+const StateSet& NFA::GetStates() const
+{
+	return states;
+}
+
+const std::set<NFA::Symbol>& NFA::GetSymbols() const
+{
+	return symbols;
+}
+
+const NFA::TransitionTable& NFA::GetTransitionTable() const
+{
+	return transitionTable;
+}
+
+const std::vector<NFA::StateId>& NFA::GetTransitions(StateId state, Symbol symbol) const
+{
+	static const std::vector<StateId> noStates;
+	const auto& it = transitionTable.find(std::make_pair(state, symbol));
+	if (it == transitionTable.end())
+		return noStates;
+	return it->second;
+}
+
+NFA::StateId NFA::GetInitialState() const
+{
+	return initialState;
+}
+
+const StateSet& NFA::GetFinalStates() const
+{
+	return finalStates;
+}
+
+const NFA::State& NFA::GetStateName(StateId state) const
+{
+	return stateTable.GetName(state);
+}
+
+bool NFA::HasLambdaTransitions() const
+{
+	return hasLambdaTransitions;
+}
+
+const EpsilonClosures& NFA::GetClosures() const
+{
+	if (!closures)
+	{
+		std::vector<std::vector<StateId>> lambdaTransitions(hasLambdaTransitions ? stateTable.GetSize() : 0);
+		for (const auto& transition : transitionTable)
+			if (transition.first.second == lambda)
+				lambdaTransitions[transition.first.first] = transition.second;
+		closures.emplace(lambdaTransitions);
+	}
+	return *closures;
+}
+
+NFA::StateId NFA::InsertState(const State& state)
+{
+	StateId id = stateTable.Intern(state);
+	states.Insert(id);
+	return id;
+}
+
+void NFA::InsertSymbol(const Symbol symbol)
+{
+	if (symbol != lambda)
+		symbols.insert(symbol);
+}
+
+void NFA::InsertTransition(const std::pair<StateId, Symbol>& pair, StateId state)
+{
+	transitionTable[pair].push_back(state);
+	if (pair.second == lambda)
+	{
+		hasLambdaTransitions = true;
+		closures.reset();
+	}
+}
+
+void NFA::SetInitialState(StateId state)
+{
+	initialState = state;
+}
+
+void NFA::InsertFinalState(StateId finalState)
+{
+	finalStates.Insert(finalState);
+}
+
+// Every name is interned as it is read; whether it was declared as a state is up to Verify.
+// The symbols section is optional and symbols used by transitions are added anyway.
+std::istream& operator>>(std::istream& in, NFA& obj)
+{
+	ElementsParser::Parse(in, [&obj](ElementsParser& parser)
+		{
+			size_t numberOfStates = parser.ReadCount();
+			obj.stateTable.Reserve(obj.stateTable.GetSize() + numberOfStates);
+			for (size_t index = 0; index < numberOfStates; ++index)
+				obj.states.Insert(obj.stateTable.Intern(parser.ReadName()));
+
+			if (parser.AtSymbols())
+			{
+				size_t numberOfSymbols = parser.ReadCount();
+				for (size_t index = 0; index < numberOfSymbols; ++index)
+					obj.InsertSymbol(parser.ReadSymbol());
+			}
+
+			// Each line is a state, a symbol and any number of next states, each of which
+			// counts as one transition.
+			size_t numberOfTransitions = parser.ReadCount();
+			while (numberOfTransitions)
+			{
+				NFA::StateId currState = obj.stateTable.Intern(parser.ReadName());
+				NFA::Symbol symbol = parser.ReadSymbol();
+				if (parser.AtLineEnd())
+					parser.Fail("expected a state");
+
+				while (!parser.AtLineEnd())
+				{
+					if (!numberOfTransitions)
+						parser.Fail("more transitions than declared");
+
+					obj.InsertTransition(std::make_pair(currState, symbol), obj.stateTable.Intern(parser.ReadName()));
+					--numberOfTransitions;
+				}
+				obj.InsertSymbol(symbol);
+			}
+
+			obj.initialState = obj.stateTable.Intern(parser.ReadName());
+
+			size_t numberOfFinalStates = parser.ReadCount();
+			for (size_t index = 0; index < numberOfFinalStates; ++index)
+				obj.InsertFinalState(obj.stateTable.Intern(parser.ReadName()));
+		});
+
+	return in;
+}
+
+// Writes the description in the format operator>> reads, one transition per line.
+std::ostream& operator<<(std::ostream& out, const NFA& obj)
+{
+	size_t numberOfTransitions = 0;
+	for (const auto& transition : obj.GetTransitionTable())
+		numberOfTransitions += transition.second.size();
+
+	out << obj.GetStates().size() << std::endl;
+	for (const auto& state : obj.GetStates())
+		out << obj.GetStateName(state) << " ";
+
+	out << std::endl << obj.GetSymbols().size() << std::endl;
+	for (const auto& symbol : obj.GetSymbols())
+		out << symbol << " ";
+
+	out << std::endl << numberOfTransitions << std::endl;
+	for (const auto& state : obj.GetStates())
+		for (const auto& symbol : obj.GetColumns())
+			for (const auto& nextState : obj.GetTransitions(state, symbol))
+				out << obj.GetStateName(state) << " " << symbol << " " << obj.GetStateName(nextState) << std::endl;
+
+	out << obj.GetStateName(obj.GetInitialState()) << std::endl;
+
+	out << obj.GetFinalStates().size() << std::endl;
+	for (const auto& finalState : obj.GetFinalStates())
+		out << obj.GetStateName(finalState) << " ";
+	return out;
+}
+
+void NFA::PrintDefinition(std::ostream& out) const
+{
+	out << "({";
+	for (const auto& state : GetStates())
+		out << GetStateName(state) << ", ";
+	out << "\b\b}, {";
+	for (const auto& symbol : GetSymbols())
+		out << symbol << ", ";
+	out << "\b\b}, d, " << GetStateName(GetInitialState()) << ", {";
+	for (const auto& finalState : GetFinalStates())
+		out << GetStateName(finalState) << ", ";
+	out << "\b\b})\nd = {\n";
+	for (const auto& state : GetStates())
+		for (const auto& symbol : GetColumns())
+		{
+			const auto& transitions = GetTransitions(state, symbol);
+			if (transitions.empty())
+				continue;
+			out << "	(" << GetStateName(state) << ", " << symbol << ") -> {";
+			for (const auto& nextState : transitions)
+				out << GetStateName(nextState) << ", ";
+			out << "\b\b}\n";
+		}
+	out << "    }\n\n";
+}
+
+void NFA::Print(std::ostream& out) const
+{
+	std::vector<Symbol> columns = GetColumns();
+	std::unordered_map<Symbol, size_t> width;
+	for (const auto& symbol : columns)
+	{
+		width[symbol] = 0;
+		for (const auto& state : GetStates())
+		{
+			const auto& transition = GetTransitions(state, symbol);
+			if (width[symbol] < transition.size())
+				width[symbol] = transition.size();
+		}
+	}
+
+	out << "      || ";
+	for (const auto& symbol : columns)
+	{
+		out << symbol << "  ";
+		for (size_t index = 1; index < width[symbol]; ++index)
+			out << "   ";
+		out << "  ";
+	}
+	out << std::endl;
+
+	out << "------++-";
+	for (const auto& symbol : columns)
+	{
+		for (size_t index = 0; index < width[symbol]; ++index)
+			out << "---";
+		out << "--";
+	}
+	out << "\b \b\b \n";
+
+	for (const auto& currState : GetStates())
+	{
+		if (currState == GetInitialState())
+			out << "-> ";
+		else
+			if (GetFinalStates().Contains(currState))
+				out << " * ";
+			else
+				out << "   ";
+
+		out << GetStateName(currState) << " || ";
+
+		for (const auto& symbol : columns)
+		{
+			const auto& it = GetTransitions(currState, symbol);
+			for (size_t index = 0; index < width[symbol]; ++index)
+				if (index < it.size())
+					out << GetStateName(it[index]) << " ";
+				else
+					out << "   ";
+			out << "  ";
+		}
+		out << std::endl;
+	}
+	out << std::endl;
+}
+
+DFA NFA::ConvertToDFA(NFA NFA, size_t numberOfThreads)
+{
+	ConversionOptions options;
+	options.numberOfThreads = numberOfThreads;
+	return ConvertToDFA(NFA, options);
+}
+
+// Brzozowski's algorithm: determinizing the reverse of an automaton whose reverse is
+// deterministic and has only reachable states gives the minimal DFA. The intermediate DFA
+// is that of the reversed language, so the subset DFA of the NFA is never built; it is
+// the right choice when that one is much larger than the minimal DFA. A last pass of
+// Hopcroft's algorithm, linear here, adds the trap state. The result is the DFA that
+// ConvertToDFA followed by Minimize gives, up to the names of its states: the subset DFA can
+// have dead subsets that are not empty, and merging them moves the trap state.
+DFA NFA::ConvertToDFA(NFA NFA, const ConversionOptions& options)
+{
+	if (!options.minimize)
+	{
+		DFA DFA = NFA.Operations(options);
+		return DFA;
+	}
+
+	ConversionOptions steps = options;
+	steps.minimize = false;
+	steps.subsets = nullptr;
+	DFA reversedDFA = ConvertToDFA(NFA.Reverse(), steps);
+	DFA DFA = ConvertToDFA(ConvertToNFA(reversedDFA).Reverse(), steps);
+	DFA::Minimize(DFA, MinimizationAlgorithm::Hopcroft);
+	return DFA;
+}
+
+NFA NFA::ConvertToNFA(const DFA& DFA)
+{
+	NFA NFA;
+	for (const auto& state : DFA.GetStates())
+		NFA.InsertState(DFA.GetStateName(state));
+	for (const auto& symbol : DFA.GetSymbols())
+		NFA.InsertSymbol(symbol);
+
+	auto id = [&DFA, &NFA](DFA::StateId state) { return NFA.InsertState(DFA.GetStateName(state)); };
+	for (const auto& transition : DFA.GetTransitionTable())
+		NFA.InsertTransition(std::make_pair(id(transition.first.first), transition.first.second), id(transition.second));
+	if (DFA.GetInitialState() != DFA::noState)
+		NFA.SetInitialState(id(DFA.GetInitialState()));
+	for (const auto& finalState : DFA.GetFinalStates())
+		NFA.InsertFinalState(id(finalState));
+
+	return NFA;
+}
+
+// The subsets are numbered in the order they are found, breadth first, and looked up by
+// hash, so each transition of the DFA costs one lookup whatever the number of subsets.
+// The successors of a batch of subsets are computed on numberOfThreads threads, then
+// numbered in the same order as on one thread, so the DFA does not depend on the threads.
+// Throws a ConversionError as soon as a new subset goes over maxStates or maxMemory.
+DFA NFA::Operations(const ConversionOptions& options)
+{
+	// The DFA state qi is the subset visited[i].
+	std::unordered_map<HashedSubset, size_t, StoredHash> indices;
+	std::vector<const Subset*> visited;
+	// nextStates[i * columns.size() + j] is the state reached from qi on columns[j].
+	const size_t noNextState = SIZE_MAX;
+	std::vector<size_t> nextStates;
+	// The bytes taken by the subsets and their entries in indices.
+	size_t subsetsMemory = 0;
+	size_t expanded = 0;
+
+	auto getProgress = [&visited, &nextStates, &subsetsMemory, &expanded]()
+	{
+		ConversionProgress progress;
+		progress.numberOfSubsets = visited.size();
+		progress.queueDepth = visited.size() - expanded;
+		progress.memoryUsage = subsetsMemory + visited.size() * sizeof(const Subset*) + nextStates.size() * sizeof(size_t);
+		return progress;
+	};
+	auto getNextState = [&](Subset&& subset)
+	{
+		HashedSubset key(std::move(subset));
+		const auto& found = indices.find(key);
+		if (found != indices.end())
+			return found->second;
+
+		if (options.maxStates && visited.size() >= options.maxStates)
+			throw ConversionError("subset construction: more than " + std::to_string(options.maxStates) + " states", getProgress());
+		subsetsMemory += nodeOverhead + sizeof(HashedSubset) + key.subset.size() * sizeof(StateId) + sizeof(size_t);
+		if (options.maxMemory && getProgress().memoryUsage > options.maxMemory)
+			throw ConversionError("subset construction: more than " + std::to_string(options.maxMemory) + " bytes", getProgress());
+
+		const auto& it = indices.emplace(std::move(key), visited.size()).first;
+		visited.push_back(&it->first.subset);
+		return it->second;
+	};
+
+	std::vector<Symbol> columns(GetSymbols().begin(), GetSymbols().end());
+	getNextState(GetClosure({ GetInitialState() }));
+	// The closures are built on first use, so not by the threads.
+	if (hasLambdaTransitions)
+		GetClosures();
+
+	const size_t batchSize = 4096, minParallelBatch = 64;
+	std::vector<Subset> batch;
+	for (size_t begin = 0; begin < visited.size(); )
+	{
+		size_t end = std::min(visited.size(), begin + batchSize);
+		batch.assign((end - begin) * columns.size(), Subset());
+		ParallelFor(end - begin, end - begin < minParallelBatch ? 1 : options.numberOfThreads, [&](size_t first, size_t last)
+			{
+				for (size_t index = first; index < last; ++index)
+					for (size_t column = 0; column < columns.size(); ++column)
+						batch[index * columns.size() + column] = GetTransition(*visited[begin + index], columns[column]);
+			});
+
+		for (auto& nextState : batch)
+			nextStates.push_back(nextState.empty() ? noNextState : getNextState(std::move(nextState)));
+		begin = expanded = end;
+		if (options.progress)
+			options.progress(getProgress());
+	}
+
+	if (options.subsets)
+	{
+		std::ostream& out = *options.subsets;
+		for (size_t index = 0; index < visited.size(); ++index)
+		{
+			out << "q" << index << ": {";
+			for (const auto& it : *visited[index])
+			{
+				out << GetStateName(it) << ", ";
+			}
+			out << "\b\b} \n";
+		}
+		out << std::endl;
+	}
+
+	DFA DFA;
+	for (const auto& symbol : columns)
+	{
+		DFA.InsertSymbol(symbol);
+	}
+
+	std::vector<DFA::StateId> newStates;
+	for (size_t index = 0; index < visited.size(); ++index)
+		newStates.push_back(DFA.InsertState("q" + std::to_string(index)));
+	DFA.SetInitialState(newStates[0]);
+
+	for (size_t index = 0; index < visited.size(); ++index)
+	{
+		for (const auto& state : *visited[index])
+		{
+			if (GetFinalStates().Contains(state))
+			{
+				DFA.InsertFinalState(newStates[index]);
+				break;
+			}
+		}
+
+		for (size_t column = 0; column < columns.size(); ++column)
+		{
+			size_t nextState = nextStates[index * columns.size() + column];
+			if (nextState != noNextState)
+				DFA.InsertTransition(std::make_pair(newStates[index], columns[column]), newStates[nextState]);
+		}
+	}
+
+	return DFA;
+}
+
+// The NFA of the reversed language: every transition turned around, the initial state
+// final, and a new initial state going on lambda to the old final states, unless there is
+// only one of them.
+NFA NFA::Reverse() const
+{
+	NFA NFA;
+	for (const auto& state : GetStates())
+		NFA.InsertState(GetStateName(state));
+	for (const auto& symbol : GetSymbols())
+		NFA.InsertSymbol(symbol);
+
+	auto id = [this, &NFA](StateId state) { return NFA.InsertState(GetStateName(state)); };
+	for (const auto& transition : GetTransitionTable())
+		for (const auto& nextState : transition.second)
+			NFA.InsertTransition(std::make_pair(id(nextState), transition.first.second), id(transition.first.first));
+
+	if (GetFinalStates().size() == 1)
+		NFA.SetInitialState(id(*GetFinalStates().begin()));
+	else
+	{
+		State initialName = "start";
+		while (stateTable.Find(initialName) != noState)
+			initialName += "'";
+		StateId newInitialState = NFA.InsertState(initialName);
+		NFA.SetInitialState(newInitialState);
+		for (const auto& finalState : GetFinalStates())
+			NFA.InsertTransition(std::make_pair(newInitialState, lambda), id(finalState));
+	}
+	if (GetInitialState() != noState)
+		NFA.InsertFinalState(id(GetInitialState()));
+
+	return NFA;
+}
+
+// The symbols, followed by lambda if there are lambda transitions.
+std::vector<NFA::Symbol> NFA::GetColumns() const
+{
+	std::vector<Symbol> columns(symbols.begin(), symbols.end());
+	if (hasLambdaTransitions)
+		columns.push_back(lambda);
+	return columns;
+}
+
+// The subset has to be sorted.
+NFA::Subset NFA::GetClosure(Subset subset) const
+{
+	if (hasLambdaTransitions)
+		GetClosures().Close(subset);
+	return subset;
+}
+
+NFA::Subset NFA::GetTransition(const Subset& currState, Symbol symbol) const
+{
+	Subset nextState;
+
+	for (const auto& state : currState)
+	{
+		const auto& transitions = GetTransitions(state, symbol);
+		nextState.insert(nextState.end(), transitions.begin(), transitions.end());
+	}
+
+	std::sort(nextState.begin(), nextState.end());
+	nextState.erase(std::unique(nextState.begin(), nextState.end()), nextState.end());
+	return GetClosure(std::move(nextState));
+}
+
+NFA::HashedSubset::HashedSubset(Subset&& other) :
+	subset(std::move(other)),
+	hash(SubsetHash()(subset))
+{
+}
+
+bool NFA::HashedSubset::operator==(const HashedSubset& other) const
+{
+	return hash == other.hash && subset == other.subset;
+}
+
+size_t NFA::StoredHash::operator()(const HashedSubset& subset) const
+{
+	return subset.hash;
+}
@@ -0,0 +1,129 @@
+#pragma once
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <unordered_map>
+#include <vector>
+#include <set>
+#include <optional>
+#include <functional>
+#include <stdexcept>
+#include "DFA.h"
+#include "EpsilonClosures.h"
+
+// How far a subset construction has gone: the DFA states found, how many of them still
+// have to be expanded, and about how many bytes the subsets and transitions take.
+struct ConversionProgress
+{
+	size_t numberOfSubsets = 0;
+	size_t queueDepth = 0;
+	size_t memoryUsage = 0;
+};
+
+// A limit of 0 is no limit. progress is called after every batch of expanded subsets.
+struct ConversionOptions
+{
+	size_t numberOfThreads = 1;
+	size_t maxStates = 0;
+	size_t maxMemory = 0;
+	std::function<void(const ConversionProgress&)> progress;
+	// If set, the subset of every DFA state is listed there.
+	std::ostream* subsets = nullptr;
+	// Gives the minimal DFA by Brzozowski's algorithm instead of the subset DFA; the limits
+	// then apply to both determinizations and subsets is not used.
+	bool minimize = false;
+};
+
+// Thrown when a subset construction goes over one of its limits.
+class ConversionError : public std::runtime_error
+{
+public:
+	ConversionError(const std::string& message, const ConversionProgress&);
+
+	const ConversionProgress& GetProgress() const;
+
+private:
+	ConversionProgress progress;
+};
+
+class NFA
+{
+public:
+	using State = std::string;
+	using StateId = StateTable::Id;
+	using Symbol = char;
+	using TransitionTable = FlatHashMap<std::pair<StateId, Symbol>, std::vector<StateId>, Hash>;
+	// Sorted by id, so that equal subsets are equal vectors.
+	using Subset = std::vector<StateId>;
+
+	static constexpr StateId noState = StateTable::noId;
+	// Transitions on lambda are taken without reading a symbol; lambda is not a symbol of the NFA.
+	static constexpr Symbol lambda = '*';
+
+public:
+	NFA() = default;
+
+	bool Verify() const;
+	bool Accepts(const std::string&) const;
+	bool Trace(const std::string&, std::ostream&) const;
+	friend std::istream& operator>>(std::istream&, NFA&);
+	friend std::ostream& operator<<(std::ostream&, const NFA&);
+	void Print(std::ostream&) const;
+	void PrintDefinition(std::ostream&) const;
+
+	const StateSet& GetStates() const;
+	const std::set<Symbol>& GetSymbols() const;
+	const TransitionTable& GetTransitionTable() const;
+	const std::vector<StateId>& GetTransitions(StateId, Symbol) const;
+	StateId GetInitialState() const;
+	const StateSet& GetFinalStates() const;
+	const State& GetStateName(StateId) const;
+	bool HasLambdaTransitions() const;
+	const EpsilonClosures& GetClosures() const;
+
+	StateId InsertState(const State&);
+	void InsertSymbol(const Symbol);
+	void InsertTransition(const std::pair<StateId, Symbol>&, StateId);
+	void SetInitialState(StateId);
+	void InsertFinalState(StateId);
+
+	static DFA ConvertToDFA(NFA NFA, size_t numberOfThreads = 1);
+	static DFA ConvertToDFA(NFA NFA, const ConversionOptions&);
+	static NFA ConvertToNFA(const DFA&);
+	DFA Operations(const ConversionOptions&);
+	NFA Reverse() const;
+
+private:
+	// A subset with its hash, computed once: a hash table hashes all of its keys again
+	// every time it grows.
+	struct HashedSubset
+	{
+		explicit HashedSubset(Subset&&);
+		bool operator==(const HashedSubset&) const;
+
+		Subset subset;
+		size_t hash;
+	};
+
+	struct StoredHash
+	{
+		size_t operator()(const HashedSubset&) const;
+	};
+
+	bool Trace(StateId, const std::string&, size_t, std::ostream&, std::vector<StateId>&) const;
+	std::vector<Symbol> GetColumns() const;
+	Subset GetClosure(Subset) const;
+	Subset GetTransition(const Subset&, Symbol) const;
+
+private:
+	StateTable stateTable;
+	StateSet states;
+	std::set<Symbol> symbols;
+	TransitionTable transitionTable;
+	StateId initialState = noState;
+	StateSet finalStates;
+	bool hasLambdaTransitions = false;
+	// Built on first use and dropped when a lambda transition is inserted.
+	mutable std::optional<EpsilonClosures> closures;
+};
+
@@ -0,0 +1,107 @@
+#include "Parallel.h"
+
+namespace
+{
+	// Set on the threads of a pool and on a thread while it runs a job, so that a nested
+	// job runs serially rather than wait on the pool.
+	thread_local bool isRunning = false;
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	wake.notify_all();
+	for (auto& worker : workers)
+		worker.join();
+}
+
+ThreadPool& ThreadPool::GetInstance()
+{
+	static ThreadPool pool;
+	return pool;
+}
+
+void ThreadPool::Run(size_t count, const std::function<void(size_t)>& task)
+{
+	if (isRunning || count <= 1)
+	{
+		for (size_t index = 0; index < count; ++index)
+			task(index);
+		return;
+	}
+
+	std::lock_guard<std::mutex> runLock(runMutex);
+	std::unique_lock<std::mutex> lock(mutex);
+	while (workers.size() + 1 < count)
+		workers.emplace_back(&ThreadPool::Work, this);
+
+	this->task = &task;
+	this->count = count;
+	next = 0;
+	++job;
+	wake.notify_all();
+
+	isRunning = true;
+	RunTasks(lock);
+	isRunning = false;
+	done.wait(lock, [this] { return running == 0; });
+
+	this->task = nullptr;
+	std::exception_ptr thrown = std::move(exception);
+	exception = nullptr;
+	lock.unlock();
+	if (thrown)
+		std::rethrow_exception(thrown);
+}
+
+size_t ThreadPool::GetNumberOfWorkers() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return workers.size();
+}
+
+void ThreadPool::Work()
+{
+	isRunning = true;
+	std::unique_lock<std::mutex> lock(mutex);
+	// A worker started during a job joins it.
+	uint64_t lastJob = 0;
+	while (true)
+	{
+		wake.wait(lock, [this, &lastJob] { return stopping || job != lastJob; });
+		if (stopping)
+			return;
+		lastJob = job;
+		RunTasks(lock);
+	}
+}
+
+void ThreadPool::RunTasks(std::unique_lock<std::mutex>& lock)
+{
+	while (next < count)
+	{
+		size_t index = next++;
+		const auto& current = *task;
+		++running;
+		lock.unlock();
+
+		std::exception_ptr thrown;
+		try
+		{
+			current(index);
+		}
+		catch (...)
+		{
+			thrown = std::current_exception();
+		}
+
+		lock.lock();
+		if (thrown && !exception)
+			exception = std::move(thrown);
+		if (--running == 0 && next == count)
+			done.notify_all();
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The number of threads to run on, numberOfThreads == 0 being every hardware thread.
+inline size_t GetNumberOfThreads(size_t numberOfThreads)
+{
+	if (numberOfThreads == 0)
+		return std::max<size_t>(1, std::thread::hardware_concurrency());
+	return numberOfThreads;
+}
+
+// Worker threads that are started once and then wait for jobs, so that a job costs a wake-up
+// instead of creating and joining threads.
+class ThreadPool
+{
+public:
+	ThreadPool() = default;
+	ThreadPool(const ThreadPool&) = delete;
+	~ThreadPool();
+
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	// The pool shared by ParallelFor.
+	static ThreadPool& GetInstance();
+
+	// Runs task(index) for every index in [0, count) on the calling thread and on up to
+	// count - 1 workers, and returns once all of them are done. The first exception thrown
+	// by a task is rethrown here. Called from within a task, it runs every index itself.
+	void Run(size_t count, const std::function<void(size_t)>& task);
+
+	size_t GetNumberOfWorkers() const;
+
+private:
+	void Work();
+	// Runs the indices of the current job that are not taken yet; the lock is held outside of tasks.
+	void RunTasks(std::unique_lock<std::mutex>& lock);
+
+private:
+	std::mutex runMutex;
+	mutable std::mutex mutex;
+	std::condition_variable wake, done;
+	std::vector<std::thread> workers;
+	bool stopping = false;
+
+	// The current job.
+	uint64_t job = 0;
+	const std::function<void(size_t)>* task = nullptr;
+	size_t count = 0, next = 0, running = 0;
+	std::exception_ptr exception;
+};
+
+// Splits [0, count) into contiguous shards and runs function(begin, end) for each
+// of them on a thread of the pool. numberOfThreads == 0 uses every hardware thread.
+template<class Function>
+void ParallelFor(size_t count, size_t numberOfThreads, Function function)
+{
+	numberOfThreads = std::min(GetNumberOfThreads(numberOfThreads), count);
+
+	if (numberOfThreads <= 1)
+	{
+		if (count)
+			function(size_t(0), count);
+		return;
+	}
+
+	size_t shard = (count + numberOfThreads - 1) / numberOfThreads;
+	ThreadPool::GetInstance().Run((count + shard - 1) / shard, [&](size_t index)
+		{
+			function(index * shard, std::min(index * shard + shard, count));
+		});
+}
@@ -0,0 +1,170 @@
+#include "PatternSet.h"
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+
+PatternSet::PatternId PatternSet::Insert(const NFA& NFA)
+{
+	patterns.emplace_back(NFA);
+	return static_cast<PatternId>(patterns.size() - 1);
+}
+
+PatternSet::PatternId PatternSet::Insert(const DFA& DFA)
+{
+	return Insert(NFA::ConvertToNFA(DFA));
+}
+
+// The states of pattern i are numbered after those of the patterns before it. Bytes in the
+// same class for every pattern share a class, and the subsets are built breadth first, with
+// the empty one as the dead state. Returns false if maxStates were not enough for all.
+bool PatternSet::Compile(size_t maxStates)
+{
+	offsets.assign(1, 0);
+	for (const auto& pattern : patterns)
+		offsets.push_back(offsets.back() + static_cast<uint32_t>(pattern.GetNumberOfStates()));
+	owners.resize(offsets.back());
+	for (PatternId pattern = 0; pattern < patterns.size(); ++pattern)
+		std::fill(owners.begin() + offsets[pattern], owners.begin() + offsets[pattern + 1], pattern);
+
+	// The classes of a byte in every pattern, one character each.
+	std::map<std::string, uint8_t> classes;
+	representatives.clear();
+	for (size_t byte = 0; byte < 256; ++byte)
+	{
+		std::string signature;
+		for (const auto& pattern : patterns)
+			signature.push_back(static_cast<char>(pattern.GetSymbolClass(static_cast<char>(byte))));
+
+		const auto& it = classes.insert(std::make_pair(signature, static_cast<uint8_t>(classes.size())));
+		if (it.second)
+			representatives.push_back(static_cast<char>(byte));
+		symbolClasses[byte] = it.first->second;
+	}
+	numberOfClasses = representatives.size();
+
+	std::unordered_map<Subset, StateId, SubsetHash> indices;
+	std::vector<const Subset*> subsets;
+	bool complete = true;
+	auto getState = [&indices, &subsets, &complete, maxStates](Subset&& subset)
+	{
+		const auto& found = indices.find(subset);
+		if (found != indices.end())
+			return found->second;
+		if (subsets.size() >= std::max<size_t>(maxStates, 2))
+		{
+			complete = false;
+			return unexplored;
+		}
+
+		const auto& it = indices.emplace(std::move(subset), static_cast<StateId>(subsets.size())).first;
+		subsets.push_back(&it->first);
+		return it->second;
+	};
+
+	getState(Subset());
+	Subset initial;
+	for (PatternId pattern = 0; pattern < patterns.size(); ++pattern)
+		if (patterns[pattern].GetNumberOfStates() != 0)
+			initial.push_back(offsets[pattern] + patterns[pattern].GetInitialState());
+	initialState = getState(std::move(initial));
+
+	transitions.assign(numberOfClasses, deadState);
+	for (StateId state = 1; state < subsets.size(); ++state)
+	{
+		transitions.resize(subsets.size() * numberOfClasses, deadState);
+		for (size_t symbolClass = 0; symbolClass < numberOfClasses; ++symbolClass)
+			transitions[state * numberOfClasses + symbolClass] = getState(GetTransition(*subsets[state], static_cast<uint8_t>(symbolClass)));
+	}
+	transitions.resize(subsets.size() * numberOfClasses, deadState);
+
+	matchOffsets.assign(1, 0);
+	matchIds.clear();
+	subsetOffsets.assign(1, 0);
+	subsetStates.clear();
+	for (const auto& subset : subsets)
+	{
+		for (const auto& globalState : *subset)
+		{
+			PatternId pattern = owners[globalState];
+			if (patterns[pattern].IsFinal(globalState - offsets[pattern]) && (matchIds.size() == matchOffsets.back() || matchIds.back() != pattern))
+				matchIds.push_back(pattern);
+		}
+		matchOffsets.push_back(static_cast<uint32_t>(matchIds.size()));
+
+		// Only needed to go on from the states with unexplored transitions.
+		if (!complete)
+			subsetStates.insert(subsetStates.end(), subset->begin(), subset->end());
+		subsetOffsets.push_back(static_cast<uint32_t>(subsetStates.size()));
+	}
+
+	return complete;
+}
+
+// O(l), l = word.length(), whatever the number of patterns, while the word stays in the
+// built subsets; the ids are sorted.
+std::vector<PatternSet::PatternId> PatternSet::Match(const std::string& word) const
+{
+	return Match(word.data(), word.data() + word.size());
+}
+
+std::vector<PatternSet::PatternId> PatternSet::Match(const char* first, const char* last) const
+{
+	StateId state = initialState;
+	for (; first != last && state != deadState; ++first)
+	{
+		StateId nextState = transitions[state * numberOfClasses + symbolClasses[static_cast<unsigned char>(*first)]];
+		if (nextState == unexplored)
+			return Simulate(state, first, last);
+		state = nextState;
+	}
+	return std::vector<PatternId>(matchIds.begin() + matchOffsets[state], matchIds.begin() + matchOffsets[state + 1]);
+}
+
+size_t PatternSet::GetNumberOfPatterns() const
+{
+	return patterns.size();
+}
+
+size_t PatternSet::GetNumberOfStates() const
+{
+	return matchOffsets.size() - 1;
+}
+
+size_t PatternSet::GetNumberOfClasses() const
+{
+	return numberOfClasses;
+}
+
+// Sorted and without duplicates.
+PatternSet::Subset PatternSet::GetTransition(const Subset& subset, uint8_t symbolClass) const
+{
+	Subset nextSubset;
+	for (const auto& globalState : subset)
+	{
+		PatternId pattern = owners[globalState];
+		CompiledNFA::Targets targets = patterns[pattern].GetTransitions(globalState - offsets[pattern], representatives[symbolClass]);
+		for (const CompiledNFA::StateId* nextState = targets.first; nextState != targets.second; ++nextState)
+			nextSubset.push_back(offsets[pattern] + *nextState);
+	}
+
+	std::sort(nextSubset.begin(), nextSubset.end());
+	nextSubset.erase(std::unique(nextSubset.begin(), nextSubset.end()), nextSubset.end());
+	return nextSubset;
+}
+
+// Goes on from a built state over the rest of the word with the subsets computed one by one.
+std::vector<PatternSet::PatternId> PatternSet::Simulate(StateId state, const char* first, const char* last) const
+{
+	Subset subset(subsetStates.begin() + subsetOffsets[state], subsetStates.begin() + subsetOffsets[state + 1]);
+	for (; first != last && !subset.empty(); ++first)
+		subset = GetTransition(subset, symbolClasses[static_cast<unsigned char>(*first)]);
+
+	std::vector<PatternId> matches;
+	for (const auto& globalState : subset)
+	{
+		PatternId pattern = owners[globalState];
+		if (patterns[pattern].IsFinal(globalState - offsets[pattern]) && (matches.empty() || matches.back() != pattern))
+			matches.push_back(pattern);
+	}
+	return matches;
+}
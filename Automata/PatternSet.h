@@ -0,0 +1,62 @@
+#pragma once
+#include "CompiledNFA.h"
+#include "DFA.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Many automata matched together. Compile builds the DFA of the subsets of the union of
+// their states, each of its states carrying the ids of the patterns whose final states it
+// holds, so a word is read once whatever the number of patterns. Patterns are numbered
+// from 0 in the order they are inserted. The subsets of many patterns can be too many to
+// build, so at most maxStates are; a word that leaves them is finished on the patterns
+// themselves, from the last subset it reached.
+class PatternSet
+{
+public:
+	using PatternId = uint32_t;
+	using StateId = uint32_t;
+
+	static constexpr StateId deadState = 0;
+	static constexpr size_t defaultMaxStates = size_t(1) << 16;
+
+public:
+	PatternSet() = default;
+
+	PatternId Insert(const NFA&);
+	PatternId Insert(const DFA&);
+	bool Compile(size_t maxStates = defaultMaxStates);
+
+	std::vector<PatternId> Match(const std::string&) const;
+	std::vector<PatternId> Match(const char*, const char*) const;
+
+	size_t GetNumberOfPatterns() const;
+	size_t GetNumberOfStates() const;
+	size_t GetNumberOfClasses() const;
+
+private:
+	static constexpr StateId unexplored = UINT32_MAX;
+
+	using Subset = std::vector<uint32_t>;
+	Subset GetTransition(const Subset&, uint8_t) const;
+	std::vector<PatternId> Simulate(StateId, const char*, const char*) const;
+
+private:
+	std::vector<CompiledNFA> patterns;
+	// State i of pattern j is offsets[j] + i in the subsets, and owners gives j back.
+	std::vector<uint32_t> offsets;
+	std::vector<PatternId> owners;
+	std::vector<char> representatives;
+
+	std::array<uint8_t, 256> symbolClasses = {};
+	size_t numberOfClasses = 1;
+	StateId initialState = deadState;
+	// transitions[state * numberOfClasses + symbol class], unexplored past maxStates
+	std::vector<StateId> transitions = std::vector<StateId>(1, deadState);
+	// The patterns matched in state are matchIds[matchOffsets[state]..matchOffsets[state + 1]).
+	std::vector<uint32_t> matchOffsets = std::vector<uint32_t>(2, 0);
+	std::vector<PatternId> matchIds;
+	// The subset of state is subsetStates[subsetOffsets[state]..subsetOffsets[state + 1]).
+	std::vector<uint32_t> subsetOffsets = std::vector<uint32_t>(2, 0);
+	std::vector<uint32_t> subsetStates;
+};
@@ -0,0 +1,241 @@
+#include "Regex.h"
+#include "ElementsParser.h"
+#include "Minimization.h"
+
+namespace
+{
+	// Recursive descent over the pattern, building one Thompson fragment per construct:
+	//     alternation = concatenation ('|' concatenation)*
+	//     concatenation = repetition*
+	//     repetition = atom ('*' | '+' | '?')*
+	//     atom = symbol | '\' symbol | '(' alternation ')' | '[' class ']'
+	class ThompsonBuilder
+	{
+	public:
+		using StateId = NFA::StateId;
+
+		struct Fragment
+		{
+			StateId start, end;
+		};
+
+	public:
+		ThompsonBuilder(const std::string& pattern, NFA& nfa) :
+			pattern(pattern),
+			nfa(nfa)
+		{
+		}
+
+		void Build()
+		{
+			Fragment fragment = ParseAlternation();
+			if (position != pattern.size())
+				Fail("unmatched ')'");
+
+			nfa.SetInitialState(fragment.start);
+			nfa.InsertFinalState(fragment.end);
+		}
+
+	private:
+		Fragment ParseAlternation()
+		{
+			Fragment fragment = ParseConcatenation();
+			if (!Peek('|'))
+				return fragment;
+
+			Fragment alternation{ NewState(), NewState() };
+			Lambda(alternation.start, fragment.start);
+			Lambda(fragment.end, alternation.end);
+			while (Peek('|'))
+			{
+				++position;
+				fragment = ParseConcatenation();
+				Lambda(alternation.start, fragment.start);
+				Lambda(fragment.end, alternation.end);
+			}
+			return alternation;
+		}
+
+		Fragment ParseConcatenation()
+		{
+			if (AtConcatenationEnd())
+			{
+				StateId state = NewState();
+				return { state, state };
+			}
+
+			Fragment concatenation = ParseRepetition();
+			while (!AtConcatenationEnd())
+			{
+				Fragment fragment = ParseRepetition();
+				Lambda(concatenation.end, fragment.start);
+				concatenation.end = fragment.end;
+			}
+			return concatenation;
+		}
+
+		Fragment ParseRepetition()
+		{
+			Fragment fragment = ParseAtom();
+			while (Peek('*') || Peek('+') || Peek('?'))
+			{
+				char repetition = pattern[position++];
+				Fragment repeated{ NewState(), NewState() };
+				Lambda(repeated.start, fragment.start);
+				Lambda(fragment.end, repeated.end);
+				if (repetition != '+')
+					Lambda(repeated.start, repeated.end);
+				if (repetition != '?')
+					Lambda(fragment.end, fragment.start);
+				fragment = repeated;
+			}
+			return fragment;
+		}
+
+		Fragment ParseAtom()
+		{
+			char character = pattern[position];
+			if (character == '*' || character == '+' || character == '?')
+				Fail("nothing to repeat");
+
+			if (character == '(')
+			{
+				++position;
+				Fragment fragment = ParseAlternation();
+				if (!Peek(')'))
+					Fail("expected ')'");
+				++position;
+				return fragment;
+			}
+
+			Fragment fragment{ NewState(), NewState() };
+			if (character == '[')
+			{
+				++position;
+				ParseClass(fragment);
+				return fragment;
+			}
+
+			Symbol(fragment, ReadSymbol());
+			return fragment;
+		}
+
+		// A class is a nonempty list of symbols and ranges up to ']'.
+		void ParseClass(const Fragment& fragment)
+		{
+			bool empty = true;
+			while (!Peek(']'))
+			{
+				if (position == pattern.size())
+					Fail("expected ']'");
+
+				char first = ReadSymbol();
+				char last = first;
+				if (Peek('-') && position + 1 < pattern.size() && pattern[position + 1] != ']')
+				{
+					++position;
+					last = ReadSymbol();
+					if (static_cast<unsigned char>(last) < static_cast<unsigned char>(first))
+						Fail("range out of order");
+				}
+
+				for (unsigned symbol = static_cast<unsigned char>(first); symbol <= static_cast<unsigned char>(last); ++symbol)
+					if (static_cast<char>(symbol) != NFA::lambda)
+						Symbol(fragment, static_cast<char>(symbol));
+				empty = false;
+			}
+
+			if (empty)
+				Fail("empty class");
+			++position;
+		}
+
+		char ReadSymbol()
+		{
+			if (position == pattern.size())
+				Fail("expected a symbol");
+
+			char character = pattern[position++];
+			if (character == '\\')
+			{
+				if (position == pattern.size())
+					Fail("expected a symbol after '\\'");
+				character = pattern[position++];
+			}
+			else if (character == '(' || character == ')' || character == '[' || character == ']' || character == '|')
+			{
+				--position;
+				Fail("unexpected '" + std::string(1, character) + "'");
+			}
+
+			if (character == NFA::lambda)
+			{
+				--position;
+				Fail("'*' cannot be a symbol, it stands for lambda");
+			}
+			return character;
+		}
+
+		bool AtConcatenationEnd() const
+		{
+			return position == pattern.size() || Peek('|') || Peek(')');
+		}
+
+		bool Peek(char character) const
+		{
+			return position < pattern.size() && pattern[position] == character;
+		}
+
+		StateId NewState()
+		{
+			return nfa.InsertState("q" + std::to_string(numberOfStates++));
+		}
+
+		void Lambda(StateId state, StateId nextState)
+		{
+			nfa.InsertTransition(std::make_pair(state, NFA::lambda), nextState);
+		}
+
+		void Symbol(const Fragment& fragment, char symbol)
+		{
+			nfa.InsertSymbol(symbol);
+			nfa.InsertTransition(std::make_pair(fragment.start, symbol), fragment.end);
+		}
+
+		[[noreturn]] void Fail(const std::string& message) const
+		{
+			throw ParseError(message, 1, position + 1);
+		}
+
+	private:
+		const std::string& pattern;
+		NFA& nfa;
+		size_t position = 0;
+		size_t numberOfStates = 0;
+	};
+}
+
+Regex::Regex(const std::string& pattern) :
+	pattern(pattern)
+{
+	ThompsonBuilder(this->pattern, nfa).Build();
+}
+
+const std::string& Regex::GetPattern() const
+{
+	return pattern;
+}
+
+const NFA& Regex::GetNFA() const
+{
+	return nfa;
+}
+
+// The subset construction of the NFA, then minimized unless asked otherwise.
+DFA Regex::ToDFA(bool minimize) const
+{
+	DFA DFA = NFA::ConvertToDFA(nfa);
+	if (minimize)
+		DFA::Minimize(DFA, MinimizationAlgorithm::Hopcroft);
+	return DFA;
+}
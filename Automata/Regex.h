@@ -0,0 +1,25 @@
+#pragma once
+#include "NFA.h"
+#include "DFA.h"
+#include <string>
+
+// A regular expression compiled to an NFA by Thompson's construction. The syntax is
+//     ab     concatenation          a|b    alternation
+//     a*     zero or more           a+     one or more          a?    zero or one
+//     (a)    grouping               [abc]  one of               [a-z] range, also inside [..]
+//     \c     the character c, for any of ( ) [ ] | * + ? \ -
+// '*' cannot be a symbol itself since the NFA uses it for lambda. Syntax errors throw a
+// ParseError whose column is the position in the pattern.
+class Regex
+{
+public:
+	explicit Regex(const std::string&);
+
+	const std::string& GetPattern() const;
+	const NFA& GetNFA() const;
+	DFA ToDFA(bool minimize = true) const;
+
+private:
+	std::string pattern;
+	NFA nfa;
+};
@@ -0,0 +1,92 @@
+#include "Scanner.h"
+#include <algorithm>
+
+namespace
+{
+	constexpr size_t noOffset = SIZE_MAX;
+}
+
+Scanner::Scanner(const CompiledDFA& dfa) :
+	dfa(dfa)
+{
+	for (size_t byte = 0; byte < canStart.size(); ++byte)
+		canStart[byte] = dfa.IsLive(dfa.GetTransition(dfa.GetInitialState(), static_cast<char>(byte)));
+}
+
+std::vector<Scanner::Match> Scanner::FindAll(const char* data, size_t size) const
+{
+	std::vector<Match> matches;
+	Scan(data, size, [&matches](size_t offset, size_t length)
+		{
+			matches.emplace_back(offset, length);
+		});
+
+	return matches;
+}
+
+std::vector<Scanner::Match> Scanner::FindAll(const MappedFile& file) const
+{
+	return FindAll(file.GetData(), file.GetSize());
+}
+
+// Finds the leftmost-longest match at or after position by following the matches from every
+// offset together, one thread per live DFA state. Threads that reach the same state share
+// their future, so only the leftmost of them is kept. Once a match is found, threads that
+// started after it are dropped, and the search ends when none of the others is left. Each
+// character is read once per live state at most, so a text without matches is scanned in
+// O(n s), n = size, s = number of states, instead of running the DFA from every offset.
+bool Scanner::FindNext(const char* data, size_t size, size_t position, Match& match, Threads& threads) const
+{
+	auto& current = threads.current;
+	auto& next = threads.next;
+	current.clear();
+	size_t matchStart = noOffset, matchEnd = 0;
+	for (; position < size; ++position)
+	{
+		unsigned char character = static_cast<unsigned char>(data[position]);
+		if (matchStart != noOffset)
+		{
+			if (current.empty())
+				break;
+		}
+		else if (canStart[character])
+			current.emplace_back(dfa.GetInitialState(), position);
+		else if (current.empty())
+			continue;
+
+		next.clear();
+		for (const auto& [state, start] : current)
+		{
+			CompiledDFA::StateId nextState = dfa.GetTransition(state, static_cast<char>(character));
+			if (!dfa.IsLive(nextState))
+				continue;
+
+			uint32_t& slot = threads.slots[nextState];
+			if (slot == Threads::noSlot)
+			{
+				slot = static_cast<uint32_t>(next.size());
+				next.emplace_back(nextState, start);
+			}
+			else
+				next[slot].second = std::min(next[slot].second, start);
+		}
+
+		for (const auto& [state, start] : next)
+		{
+			threads.slots[state] = Threads::noSlot;
+			if (dfa.IsFinal(state) && start <= matchStart)
+			{
+				matchStart = start;
+				matchEnd = position + 1;
+			}
+		}
+		if (matchStart != noOffset)
+			next.erase(std::remove_if(next.begin(), next.end(), [matchStart](const auto& thread) { return thread.second > matchStart; }), next.end());
+		current.swap(next);
+	}
+
+	if (matchStart == noOffset)
+		return false;
+	match = Match(matchStart, matchEnd - matchStart);
+	return true;
+}
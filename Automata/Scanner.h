@@ -0,0 +1,47 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "CompiledDFA.h"
+#include "MappedFile.h"
+
+class Scanner
+{
+public:
+	using Match = std::pair<size_t, size_t>;
+
+public:
+	explicit Scanner(const CompiledDFA&);
+
+	std::vector<Match> FindAll(const char*, size_t) const;
+	std::vector<Match> FindAll(const MappedFile&) const;
+
+	// Calls callback(offset, length) for every leftmost-longest, non-overlapping, non-empty match.
+	template<class Callback>
+	void Scan(const char* data, size_t size, Callback callback) const
+	{
+		Threads threads;
+		threads.slots.assign(dfa.GetNumberOfStates(), Threads::noSlot);
+
+		Match match;
+		for (size_t position = 0; FindNext(data, size, position, match, threads); position = match.first + match.second)
+			callback(match.first, match.second);
+	}
+
+private:
+	// A thread is a DFA state with the leftmost offset that reached it; slots[state] is
+	// where the state is in next while a step is computed.
+	struct Threads
+	{
+		static constexpr uint32_t noSlot = UINT32_MAX;
+
+		std::vector<std::pair<CompiledDFA::StateId, size_t>> current, next;
+		std::vector<uint32_t> slots;
+	};
+
+	bool FindNext(const char*, size_t, size_t, Match&, Threads&) const;
+
+private:
+	const CompiledDFA& dfa;
+	std::array<bool, 256> canStart{};
+};
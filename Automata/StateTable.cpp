@@ -0,0 +1,145 @@
+#include "StateTable.h"
+#include <algorithm>
+#include <cstring>
+
+StateTable::StateTable(const StateTable& other)
+{
+	*this = other;
+}
+
+// The keys of the copied map would point into the other table's names.
+StateTable& StateTable::operator=(const StateTable& other)
+{
+	if (this == &other)
+		return *this;
+
+	names.clear();
+	ids.clear();
+	Reserve(other.names.size());
+	for (const auto& name : other.names)
+		Intern(name);
+	return *this;
+}
+
+StateTable::Id StateTable::Intern(std::string_view name)
+{
+	HashedName key = GetKey(name);
+	const auto& it = ids.find(key);
+	if (it != ids.end())
+		return it->second;
+
+	Id id = static_cast<Id>(names.size());
+	names.emplace_back(name);
+	key.name = names.back();
+	ids.insert(std::make_pair(key, id));
+	return id;
+}
+
+StateTable::Id StateTable::Find(std::string_view name) const
+{
+	const auto& it = ids.find(GetKey(name));
+	if (it == ids.end())
+		return noId;
+	return it->second;
+}
+
+// Room for numberOfNames names in all, such as the declared states of a description.
+void StateTable::Reserve(size_t numberOfNames)
+{
+	ids.reserve(numberOfNames);
+}
+
+const std::string& StateTable::GetName(Id id) const
+{
+	static const std::string noName;
+	if (id >= names.size())
+		return noName;
+	return names[id];
+}
+
+size_t StateTable::GetSize() const
+{
+	return names.size();
+}
+
+StateTable::HashedName StateTable::GetKey(std::string_view name)
+{
+	HashedName key;
+	key.name = name;
+	key.hash = std::hash<std::string_view>()(name);
+	std::memcpy(&key.prefix, name.data(), std::min(name.size(), sizeof(key.prefix)));
+	return key;
+}
+
+bool StateTable::HashedName::operator==(const HashedName& other) const
+{
+	return hash == other.hash && prefix == other.prefix && name.size() == other.name.size() &&
+		(name.size() <= sizeof(prefix) || name.substr(sizeof(prefix)) == other.name.substr(sizeof(prefix)));
+}
+
+size_t StateTable::NameHash::operator()(const HashedName& name) const
+{
+	return name.hash;
+}
+
+bool StateSet::Insert(Id id)
+{
+	if (id >= members.size())
+		members.resize(id + 1, false);
+	if (members[id])
+		return false;
+
+	members[id] = true;
+	ids.push_back(id);
+	return true;
+}
+
+bool StateSet::Erase(Id id)
+{
+	if (!Contains(id))
+		return false;
+
+	members[id] = false;
+	ids.erase(std::find(ids.begin(), ids.end(), id));
+	return true;
+}
+
+// One pass over the set, whatever the number of ids.
+size_t StateSet::Erase(const std::vector<Id>& erased)
+{
+	size_t numberOfErased = 0;
+	for (const auto& id : erased)
+		if (Contains(id))
+		{
+			members[id] = false;
+			++numberOfErased;
+		}
+
+	ids.erase(std::remove_if(ids.begin(), ids.end(), [this](Id id) { return !Contains(id); }), ids.end());
+	return numberOfErased;
+}
+
+bool StateSet::Contains(Id id) const
+{
+	return id < members.size() && members[id];
+}
+
+size_t StateSet::size() const
+{
+	return ids.size();
+}
+
+bool StateSet::empty() const
+{
+	return ids.empty();
+}
+
+StateSet::const_iterator StateSet::begin() const
+{
+	return ids.begin();
+}
+
+StateSet::const_iterator StateSet::end() const
+{
+	return ids.end();
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "FlatHashMap.h"
+
+// Gives every state name a dense id the first time it is seen, so automata store,
+// compare and hash 32-bit ids; the names are only needed again for output.
+class StateTable
+{
+public:
+	using Id = uint32_t;
+
+	static constexpr Id noId = UINT32_MAX;
+
+public:
+	StateTable() = default;
+	StateTable(const StateTable&);
+	StateTable(StateTable&&) = default;
+
+	StateTable& operator=(const StateTable&);
+	StateTable& operator=(StateTable&&) = default;
+
+	Id Intern(std::string_view);
+	Id Find(std::string_view) const;
+	void Reserve(size_t);
+	const std::string& GetName(Id) const;
+	size_t GetSize() const;
+
+private:
+	// A name with its hash and its first 8 bytes, so that probing compares hashes, and a match
+	// only reads the stored name past those 8 bytes: one cache miss per lookup instead of two.
+	struct HashedName
+	{
+		bool operator==(const HashedName&) const;
+
+		std::string_view name;
+		size_t hash = 0;
+		uint64_t prefix = 0;
+	};
+
+	struct NameHash
+	{
+		size_t operator()(const HashedName&) const;
+	};
+
+	static HashedName GetKey(std::string_view);
+
+private:
+	// A deque never moves its elements, so the keys can point into the names.
+	std::deque<std::string> names;
+	FlatHashMap<HashedName, Id, NameHash> ids;
+};
+
+// A set of ids that keeps them in insertion order and tests membership in constant time.
+class StateSet
+{
+public:
+	using Id = StateTable::Id;
+	using const_iterator = std::vector<Id>::const_iterator;
+
+public:
+	bool Insert(Id);
+	bool Erase(Id);
+	// The number of ids that were in the set; an id listed twice is erased and counted once.
+	size_t Erase(const std::vector<Id>&);
+	bool Contains(Id) const;
+
+	size_t size() const;
+	bool empty() const;
+	const_iterator begin() const;
+	const_iterator end() const;
+
+private:
+	std::vector<Id> ids;
+	std::vector<bool> members;
+};
@@ -0,0 +1,46 @@
+#include "StreamMatcher.h"
+
+StreamMatcher::StreamMatcher(const CompiledDFA& dfa) :
+	dfa(dfa), currState(dfa.GetInitialState()) {}
+
+// Returns false once the matcher is dead; the rest of the chunk is not read.
+bool StreamMatcher::Feed(const char* data, size_t length)
+{
+	const char* stop = dfa.Run(currState, data, data + length);
+	position += stop - data;
+	return !IsDead();
+}
+
+bool StreamMatcher::Feed(const std::string& chunk)
+{
+	return Feed(chunk.data(), chunk.size());
+}
+
+void StreamMatcher::Reset()
+{
+	currState = dfa.GetInitialState();
+	position = 0;
+}
+
+// noContinuation if no continuation of the input can be accepted, otherwise 0 or 1 for the input so far
+size_t StreamMatcher::Accepts() const
+{
+	if (IsDead())
+		return noContinuation;
+	return dfa.IsFinal(currState);
+}
+
+bool StreamMatcher::IsDead() const
+{
+	return !dfa.IsLive(currState);
+}
+
+CompiledDFA::StateId StreamMatcher::GetState() const
+{
+	return currState;
+}
+
+uint64_t StreamMatcher::GetPosition() const
+{
+	return position;
+}
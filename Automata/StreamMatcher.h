@@ -0,0 +1,28 @@
+#pragma once
+#include "CompiledDFA.h"
+
+class StreamMatcher
+{
+public:
+	// What Accepts returns once no continuation of the input can be accepted. That is not
+	// only when the DFA has frozen on a missing transition, which CompiledDFA::Accepts
+	// reports as -1, but also in any state from which no final state can be reached.
+	static constexpr size_t noContinuation = -1;
+
+public:
+	explicit StreamMatcher(const CompiledDFA&);
+
+	bool Feed(const char*, size_t);
+	bool Feed(const std::string&);
+	void Reset();
+
+	size_t Accepts() const;
+	bool IsDead() const;
+	CompiledDFA::StateId GetState() const;
+	uint64_t GetPosition() const;
+
+private:
+	const CompiledDFA& dfa;
+	CompiledDFA::StateId currState;
+	uint64_t position = 0;
+};
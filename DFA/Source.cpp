@@ -1,51 +1,177 @@
-#include "DFA.h"
-#include <fstream>
-
-int main()
-{
-	std::ifstream fin("elements.txt");
-	DFA DFA;
-	fin >> DFA;
-	if (DFA.Verify())
-	{
-		std::cout << "OK ! \n";
-		DFA.Print(std::cout);
-		std::cout << "M = " << DFA;
-
-		bool option;
-		do
-		{
-			std::cout << "Testing word...... 1 \n";
-			std::cout << "Exit.............. 0 \n";
-			std::cout << "Choose your option: ";
-			std::cin >> option;
-			switch (option)
-			{
-			case 0:
-				break;
-			case 1:
-				std::string word;
-				std::cout << "Write a word: ";
-				std::cin >> word;
-				switch (DFA.Accepts(word))
-				{
-				case -1:
-					std::cout << "The DFA has frozen...\n";
-					break;
-				case 0:
-					std::cout << "Word is not accepted ! \n";
-					break;
-				case 1:
-					std::cout << "Word accepted ! \n";
-				}
-				break;
-			}
-			std::cout << "\n\n";
-
-		} while (option != 0);
-	}
-	else
-		std::cout << "NOT OK !\n";
-
-	return 0;
+#include "DFA.h"
+#include "CompiledDFA.h"
+#include "StreamMatcher.h"
+#include "Scanner.h"
+#include "ElementsParser.h"
+#include <fstream>
+
+int main()
+{
+	std::ifstream fin("elements.txt");
+	DFA DFA;
+	try
+	{
+		fin >> DFA;
+	}
+	catch (const ParseError& error)
+	{
+		std::cout << "elements.txt: " << error.what() << "\n";
+		return 1;
+	}
+	if (DFA.Verify())
+	{
+		std::cout << "OK ! \n";
+		DFA.Print(std::cout);
+		std::cout << "M = ";
+		DFA.PrintDefinition(std::cout);
+
+		CompiledDFA compiledDFA(DFA);
+
+		size_t option;
+		do
+		{
+			std::cout << "Testing word...... 1 \n";
+			std::cout << "Testing file...... 2 \n";
+			std::cout << "Testing stream.... 3 \n";
+			std::cout << "Scanning file..... 4 \n";
+			std::cout << "Saving DFA........ 5 \n";
+			std::cout << "Loading DFA....... 6 \n";
+			std::cout << "Exit.............. 0 \n";
+			std::cout << "Choose your option: ";
+			std::cin >> option;
+			switch (option)
+			{
+			case 0:
+				break;
+			case 1:
+			{
+				std::string word;
+				std::cout << "Write a word: ";
+				std::cin >> word;
+				switch (compiledDFA.Accepts(word))
+				{
+				case size_t(-1):
+					std::cout << "The DFA has frozen...\n";
+					break;
+				case 0:
+					std::cout << "Word is not accepted ! \n";
+					break;
+				case 1:
+					std::cout << "Word accepted ! \n";
+				}
+				break;
+			}
+			case 2:
+			{
+				std::string fileName;
+				std::cout << "Write the name of a file with one word per line: ";
+				std::cin >> fileName;
+
+				std::ifstream words(fileName, std::ios::binary);
+				std::string buffer((std::istreambuf_iterator<char>(words)), std::istreambuf_iterator<char>());
+
+				size_t accepted = 0, rejected = 0, frozen = 0;
+				for (const auto& result : compiledDFA.AcceptsLines(buffer, 0))
+				{
+					switch (result)
+					{
+					case size_t(-1):
+						++frozen;
+						break;
+					case 0:
+						++rejected;
+						break;
+					case 1:
+						++accepted;
+					}
+				}
+
+				std::cout << "Accepted: " << accepted << "\n";
+				std::cout << "Not accepted: " << rejected << "\n";
+				std::cout << "Frozen: " << frozen << "\n";
+				break;
+			}
+			case 3:
+			{
+				std::string fileName;
+				std::cout << "Write the name of a file to read as one word: ";
+				std::cin >> fileName;
+
+				std::ifstream stream(fileName, std::ios::binary);
+				StreamMatcher matcher(compiledDFA);
+				std::vector<char> chunk(1 << 16);
+				while (stream.read(chunk.data(), chunk.size()) || stream.gcount())
+					if (!matcher.Feed(chunk.data(), stream.gcount()))
+						break;
+
+				switch (matcher.Accepts())
+				{
+				case StreamMatcher::noContinuation:
+					if (matcher.GetState() == CompiledDFA::deadState)
+						std::cout << "The DFA has frozen after " << matcher.GetPosition() << " characters...\n";
+					else
+						std::cout << "No continuation can be accepted after " << matcher.GetPosition() << " characters...\n";
+					break;
+				case 0:
+					std::cout << "Word is not accepted ! \n";
+					break;
+				case 1:
+					std::cout << "Word accepted ! \n";
+				}
+				break;
+			}
+			case 4:
+			{
+				std::string fileName;
+				std::cout << "Write the name of a file to search for accepted words: ";
+				std::cin >> fileName;
+
+				MappedFile file(fileName);
+				if (!file.IsOpen())
+				{
+					std::cout << "Cannot open " << fileName << "\n";
+					break;
+				}
+
+				size_t numberOfMatches = 0;
+				Scanner(compiledDFA).Scan(file.GetData(), file.GetSize(), [&](size_t offset, size_t length)
+					{
+						std::cout << "(" << offset << ", " << length << ") ";
+						std::cout.write(file.GetData() + offset, length) << "\n";
+						++numberOfMatches;
+					});
+				std::cout << "Matches: " << numberOfMatches << "\n";
+				break;
+			}
+			case 5:
+			{
+				std::string fileName;
+				std::cout << "Write the name of the binary file: ";
+				std::cin >> fileName;
+				if (compiledDFA.Save(fileName))
+					std::cout << "Saved " << compiledDFA.GetNumberOfStates() << " states to " << fileName << "\n";
+				else
+					std::cout << "Cannot write " << fileName << "\n";
+				break;
+			}
+			case 6:
+			{
+				std::string fileName;
+				std::cout << "Write the name of the binary file: ";
+				std::cin >> fileName;
+				if (compiledDFA.Load(fileName))
+					std::cout << "Loaded " << compiledDFA.GetNumberOfStates() << " states from " << fileName << "\n";
+				else
+					std::cout << "Cannot load " << fileName << "\n";
+				break;
+			}
+			}
+			std::cout << "\n\n";
+
+		} while (option != 0);
+	}
+	else
+		std::cout << "NOT OK !\n";
+
+	return 0;
 }
\ No newline at end of file
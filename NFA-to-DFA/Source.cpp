@@ -1,62 +1,227 @@
-#include <fstream>
-#include "DFA.h"
-#include "NFA.h"
-
-int main()
-{
-	std::ifstream fin("nfa_elements.txt");
-	NFA NFA;
-	fin >> NFA;
-	fin.close();
-
-	if (NFA.Verify())
-	{
-		std::cout << "OK ! \n";
-
-		NFA.Print(std::cout);
-		DFA DFA = NFA::ConvertToDFA(NFA);
-
-		std::ofstream fout("dfa_elements.txt");
-		fout << DFA;
-		fout.close();
-
-		std::cout << "Converted NFA to DFA: \n\n";
-		DFA.Print(std::cout);
-
-		bool option;
-		do
-		{
-			std::cout << "Testing word....... 1 \n";
-			std::cout << "Exit............... 0 \n";
-			std::cout << "Choose your option: ";
-			std::cin >> option;
-			switch (option)
-			{
-			case 0:
-				break;
-			case 1:
-				std::string word;
-				std::cout << "Write a word: ";
-				std::cin >> word;
-				switch (DFA.Accepts(word))
-				{
-				case -1:
-					std::cout << "The DFA has frozen...\n";
-					break;
-				case 0:
-					std::cout << "Word is not accepted ! \n";
-					break;
-				case 1:
-					std::cout << "Word accepted ! \n";
-				}
-				break;
-			}
-			std::cout << "\n\n";
-
-		} while (option != 0);
-	}
-	else
-		std::cout << "NOT OK !\n";
-
-	return 0;
+#include <fstream>
+#include <chrono>
+#include <functional>
+#include <optional>
+#include "DFA.h"
+#include "NFA.h"
+#include "CompiledDFA.h"
+#include "BitParallelNFA.h"
+#include "LazyDFA.h"
+#include "Regex.h"
+#include "PatternSet.h"
+#include "ElementsParser.h"
+#include "Minimization.h"
+
+// Matches every line of the text with one engine and prints how many were accepted and how fast.
+void Measure(const std::string& engine, const std::vector<std::string>& lines, size_t size, const std::function<bool(const std::string&)>& accepts)
+{
+	auto start = std::chrono::steady_clock::now();
+	size_t accepted = 0;
+	for (const auto& line : lines)
+		accepted += accepts(line);
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << engine << accepted << " accepted, " << seconds * 1000 << " ms, " << size / seconds / 1e6 << " MB/s\n";
+}
+
+void Benchmark(const Regex& regex, const std::string& fileName)
+{
+	std::ifstream fin(fileName);
+	std::vector<std::string> lines;
+	size_t size = 0;
+	for (std::string line; std::getline(fin, line); size += line.size())
+		lines.push_back(line);
+	if (lines.empty())
+	{
+		std::cout << "Cannot read " << fileName << "\n";
+		return;
+	}
+
+	const NFA& NFA = regex.GetNFA();
+	// Past a million states the DFA is left out and the NFA engines are measured alone.
+	ConversionOptions options;
+	options.numberOfThreads = 0;
+	options.maxStates = size_t(1) << 20;
+	std::optional<CompiledDFA> compiledDFA;
+	try
+	{
+		DFA DFA = NFA::ConvertToDFA(NFA, options);
+		DFA::Minimize(DFA, MinimizationAlgorithm::Hopcroft);
+		compiledDFA.emplace(DFA);
+	}
+	catch (const ConversionError& error)
+	{
+		std::cout << "\nNo DFA, " << error.what() << "\n";
+	}
+	LazyDFA lazyDFA(NFA);
+	std::optional<BitParallelNFA> bitParallelNFA;
+	if (BitParallelNFA::Supports(NFA))
+		bitParallelNFA.emplace(NFA);
+
+	std::cout << "\n" << lines.size() << " lines, " << size << " bytes, " << NFA.GetStates().size() << " NFA states";
+	if (compiledDFA)
+		std::cout << ", " << compiledDFA->GetNumberOfStates() << " minimal DFA states";
+	std::cout << "\n";
+	Measure("NFA................ ", lines, size, [&NFA](const std::string& line) { return NFA.Accepts(line); });
+	if (bitParallelNFA)
+		Measure("Bit-parallel NFA... ", lines, size, [&bitParallelNFA](const std::string& line) { return bitParallelNFA->Accepts(line); });
+	Measure("Lazy DFA........... ", lines, size, [&lazyDFA](const std::string& line) { return lazyDFA.Accepts(line); });
+	if (compiledDFA)
+		Measure("Minimal DFA........ ", lines, size, [&compiledDFA](const std::string& line) { return compiledDFA->Accepts(line) == 1; });
+}
+
+// Reads one regex per line and tells for every word in the text the lines of the regexes it matches.
+void MatchPatterns(const std::string& patternsFileName, const std::string& wordsFileName)
+{
+	std::ifstream patternsFile(patternsFileName);
+	PatternSet patterns;
+	size_t lineNumber = 0;
+	for (std::string line; std::getline(patternsFile, line); )
+	{
+		++lineNumber;
+		try
+		{
+			patterns.Insert(Regex(line).GetNFA());
+		}
+		catch (const ParseError& error)
+		{
+			std::cout << patternsFileName << ":" << lineNumber << ": " << error.what() << "\n";
+			return;
+		}
+	}
+	if (patterns.GetNumberOfPatterns() == 0)
+	{
+		std::cout << "Cannot read " << patternsFileName << "\n";
+		return;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	bool complete = patterns.Compile();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "\n" << patterns.GetNumberOfPatterns() << " patterns, " << patterns.GetNumberOfStates() << " states"
+		<< (complete ? "" : " (partially built)") << ", compiled in " << seconds * 1000 << " ms\n";
+
+	std::ifstream wordsFile(wordsFileName);
+	for (std::string word; std::getline(wordsFile, word); )
+	{
+		std::cout << word << ":";
+		for (const auto& pattern : patterns.Match(word))
+			std::cout << " " << pattern + 1;
+		std::cout << "\n";
+	}
+}
+
+int main()
+{
+	std::ifstream fin("nfa_elements.txt");
+	NFA NFA;
+	try
+	{
+		fin >> NFA;
+	}
+	catch (const ParseError& error)
+	{
+		std::cout << "nfa_elements.txt: " << error.what() << "\n";
+		return 1;
+	}
+	fin.close();
+
+	if (NFA.Verify())
+	{
+		std::cout << "OK ! \n";
+
+		NFA.Print(std::cout);
+		ConversionOptions options;
+		options.numberOfThreads = 0;
+		options.subsets = &std::cout;
+		DFA DFA = NFA::ConvertToDFA(NFA, options);
+
+		std::ofstream fout("dfa_elements.txt");
+		fout << DFA;
+		fout.close();
+
+		std::cout << "Converted NFA to DFA: \n\n";
+		DFA.Print(std::cout);
+
+		size_t option;
+		do
+		{
+			std::cout << "Testing word....... 1 \n";
+			std::cout << "Regex to DFA....... 2 \n";
+			std::cout << "Benchmark regex.... 3 \n";
+			std::cout << "Matching patterns.. 4 \n";
+			std::cout << "Exit............... 0 \n";
+			std::cout << "Choose your option: ";
+			std::cin >> option;
+			switch (option)
+			{
+			case 0:
+				break;
+			case 1:
+			{
+				std::string word;
+				std::cout << "Write a word: ";
+				std::cin >> word;
+				switch (DFA.Accepts(word))
+				{
+				case size_t(-1):
+					std::cout << "The DFA has frozen...\n";
+					break;
+				case 0:
+					std::cout << "Word is not accepted ! \n";
+					break;
+				case 1:
+					std::cout << "Word accepted ! \n";
+				}
+				break;
+			}
+			case 2:
+			case 3:
+			{
+				std::string pattern;
+				std::cout << "Write a regex: ";
+				std::cin >> pattern;
+				try
+				{
+					Regex regex(pattern);
+					if (option == 2)
+					{
+						regex.GetNFA().Print(std::cout);
+						DFA = regex.ToDFA();
+						std::cout << "The minimal DFA, used from now on for testing words: \n\n";
+						DFA.Print(std::cout);
+					}
+					else
+					{
+						std::string fileName;
+						std::cout << "Write the name of a text file, one word per line: ";
+						std::cin >> fileName;
+						Benchmark(regex, fileName);
+					}
+				}
+				catch (const ParseError& error)
+				{
+					std::cout << "regex: " << error.what() << "\n";
+				}
+				break;
+			}
+			case 4:
+			{
+				std::string patternsFileName, wordsFileName;
+				std::cout << "Write the name of a file of regexes, one per line: ";
+				std::cin >> patternsFileName;
+				std::cout << "Write the name of a text file, one word per line: ";
+				std::cin >> wordsFileName;
+				MatchPatterns(patternsFileName, wordsFileName);
+				break;
+			}
+			}
+			std::cout << "\n\n";
+
+		} while (option != 0);
+	}
+	else
+		std::cout << "NOT OK !\n";
+
+	return 0;
 }
\ No newline at end of file
@@ -1,47 +1,109 @@
-#include "NFA.h"
-#include <fstream>
-
-int main()
-{
-	std::ifstream fin("elements.txt");
-	NFA NFA;
-	fin >> NFA;
-	if (NFA.Verify())
-	{
-		std::cout << "OK ! \n";
-		std::cout << std::endl;
-		NFA.Print(std::cout);
-
-		size_t option;
-		do
-		{
-			std::cout << "Testing word....... 1 \n";
-			std::cout << "Exit............... 0 \n";
-			std::cout << "Choose your option: ";
-			std::cin >> option;
-			switch (option)
-			{
-			case 0:
-				break;
-			case 1:
-				try
-				{
-					std::string word;
-					std::cout << "Write a word: ";
-					std::cin >> word;
-					NFA.Accepts(NFA.GetInitialState(), word, 0);
-				}
-				catch (const char* message)
-				{
-					std::cout << message;
-				}
-				break;
-			}
-			std::cout << "\n\n";
-
-		} while (option != 0);
-	}
-	else
-		std::cout << "NOT OK ! \n";
-	return 0;
+#include "NFA.h"
+#include "CompiledNFA.h"
+#include "BitParallelNFA.h"
+#include "LazyDFA.h"
+#include "ElementsParser.h"
+#include <fstream>
+#include <optional>
+
+int main()
+{
+	std::ifstream fin("elements.txt");
+	NFA NFA;
+	try
+	{
+		fin >> NFA;
+	}
+	catch (const ParseError& error)
+	{
+		std::cout << "elements.txt: " << error.what() << "\n";
+		return 1;
+	}
+	if (NFA.Verify())
+	{
+		std::cout << "OK ! \n";
+		std::cout << std::endl;
+		NFA.Print(std::cout);
+
+		// Small NFAs are matched on bit masks of states, larger ones on a lazily built DFA.
+		std::optional<BitParallelNFA> bitParallelNFA;
+		std::optional<LazyDFA> lazyDFA;
+		if (BitParallelNFA::Supports(NFA))
+			bitParallelNFA.emplace(NFA);
+		else
+			lazyDFA.emplace(NFA);
+
+		size_t option;
+		do
+		{
+			std::cout << "Testing word....... 1 \n";
+			std::cout << "Saving NFA......... 2 \n";
+			std::cout << "Loading NFA........ 3 \n";
+			std::cout << "Tracing word....... 4 \n";
+			std::cout << "Exit............... 0 \n";
+			std::cout << "Choose your option: ";
+			std::cin >> option;
+			switch (option)
+			{
+			case 0:
+				break;
+			case 1:
+			{
+				std::string word;
+				std::cout << "Write a word: ";
+				std::cin >> word;
+				if (bitParallelNFA ? bitParallelNFA->Accepts(word) : lazyDFA->Accepts(word))
+					std::cout << "The word is accepted ! \n";
+				else
+					std::cout << "The word is not accepted ! \n";
+				break;
+			}
+			case 2:
+			{
+				std::string fileName;
+				std::cout << "Write the name of the binary file: ";
+				std::cin >> fileName;
+				if (CompiledNFA(NFA).Save(fileName))
+					std::cout << "Saved to " << fileName << "\n";
+				else
+					std::cout << "Cannot write " << fileName << "\n";
+				break;
+			}
+			case 3:
+			{
+				std::string fileName, word;
+				std::cout << "Write the name of the binary file: ";
+				std::cin >> fileName;
+
+				CompiledNFA compiledNFA;
+				if (!compiledNFA.Load(fileName))
+				{
+					std::cout << "Cannot load " << fileName << "\n";
+					break;
+				}
+
+				std::cout << "Write a word: ";
+				std::cin >> word;
+				if (compiledNFA.Accepts(word))
+					std::cout << "The word is accepted ! \n";
+				else
+					std::cout << "The word is not accepted ! \n";
+				break;
+			}
+			case 4:
+			{
+				std::string word;
+				std::cout << "Write a word: ";
+				std::cin >> word;
+				NFA.Trace(word, std::cout);
+				break;
+			}
+			}
+			std::cout << "\n\n";
+
+		} while (option != 0);
+	}
+	else
+		std::cout << "NOT OK ! \n";
+	return 0;
 }
\ No newline at end of file
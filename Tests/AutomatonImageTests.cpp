@@ -0,0 +1,188 @@
+#include "Check.h"
+#include "CompiledDFA.h"
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+const std::string fileName = (std::filesystem::temp_directory_path() / "AutomatonImageTests.fldfa").string();
+
+std::string ReadFile()
+{
+	std::ifstream in(fileName, std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void WriteFile(const std::string& contents)
+{
+	std::ofstream out(fileName, std::ios::binary | std::ios::trunc);
+	out.write(contents.data(), contents.size());
+}
+
+// Words over {a, b} with an even number of a's and at least one b, with state names of different lengths.
+DFA GetDFA()
+{
+	DFA DFA;
+	DFA::StateId even = DFA.InsertState("even"), odd = DFA.InsertState("odd"), evenB = DFA.InsertState("even-with-b"),
+		oddB = DFA.InsertState("oddB");
+	DFA.InsertSymbol('a');
+	DFA.InsertSymbol('b');
+	DFA.SetInitialState(even);
+	DFA.InsertTransition(std::make_pair(even, 'a'), odd);
+	DFA.InsertTransition(std::make_pair(odd, 'a'), even);
+	DFA.InsertTransition(std::make_pair(even, 'b'), evenB);
+	DFA.InsertTransition(std::make_pair(odd, 'b'), oddB);
+	DFA.InsertTransition(std::make_pair(evenB, 'a'), oddB);
+	DFA.InsertTransition(std::make_pair(oddB, 'a'), evenB);
+	DFA.InsertTransition(std::make_pair(evenB, 'b'), evenB);
+	DFA.InsertTransition(std::make_pair(oddB, 'b'), oddB);
+	DFA.InsertFinalState(evenB);
+	return DFA;
+}
+
+bool Equals(const CompiledDFA& compiledDFA1, const CompiledDFA& compiledDFA2)
+{
+	if (compiledDFA1.GetNumberOfStates() != compiledDFA2.GetNumberOfStates() ||
+		compiledDFA1.GetNumberOfClasses() != compiledDFA2.GetNumberOfClasses() ||
+		compiledDFA1.GetInitialState() != compiledDFA2.GetInitialState())
+		return false;
+
+	for (CompiledDFA::StateId state = 0; state < compiledDFA1.GetNumberOfStates(); ++state)
+	{
+		if (compiledDFA1.GetStateName(state) != compiledDFA2.GetStateName(state) ||
+			compiledDFA1.IsFinal(state) != compiledDFA2.IsFinal(state) ||
+			compiledDFA1.IsLive(state) != compiledDFA2.IsLive(state))
+			return false;
+		for (const auto& symbol : { 'a', 'b', 'c' })
+			if (compiledDFA1.GetTransition(state, symbol) != compiledDFA2.GetTransition(state, symbol))
+				return false;
+	}
+
+	for (const std::string word : { "", "b", "ab", "aab", "abab", "baa", "bab", "c", "aabc" })
+		if (compiledDFA1.Accepts(word) != compiledDFA2.Accepts(word))
+			return false;
+	return true;
+}
+
+void TestRoundTrip()
+{
+	CompiledDFA compiledDFA(GetDFA());
+	CHECK(compiledDFA.Accepts("aab") == 1);
+	CHECK(compiledDFA.Accepts("ab") == 0);
+
+	for (bool verify : { true, false })
+	{
+		CHECK(compiledDFA.Save(fileName));
+		CompiledDFA loaded;
+		CHECK(loaded.Load(fileName, verify));
+		CHECK(Equals(compiledDFA, loaded));
+	}
+
+	// The loaded automaton maps the file, and a copy keeps the mapping alive.
+	CompiledDFA copy;
+	{
+		CompiledDFA loaded;
+		CHECK(loaded.Load(fileName));
+		copy = loaded;
+	}
+	CHECK(Equals(compiledDFA, copy));
+}
+
+// A file that fails to load leaves the automaton as it was.
+void CheckRejected(const std::string& contents, bool verify)
+{
+	WriteFile(contents);
+	CompiledDFA compiledDFA(GetDFA());
+	CHECK(!compiledDFA.Load(fileName, verify));
+	CHECK(Equals(compiledDFA, CompiledDFA(GetDFA())));
+}
+
+void TestCorruptFiles()
+{
+	CHECK(CompiledDFA(GetDFA()).Save(fileName));
+	const std::string contents = ReadFile();
+	const size_t headerSize = sizeof(AutomatonImage::Header);
+	CHECK(contents.size() > headerSize);
+
+	CompiledDFA missing;
+	CHECK(!missing.Load(fileName + ".missing"));
+
+	// Truncated anywhere, including inside the header.
+	for (size_t size : { size_t(0), size_t(4), headerSize - 1, headerSize, headerSize + 8, contents.size() - 1 })
+		for (bool verify : { true, false })
+			CheckRejected(contents.substr(0, size), verify);
+	CheckRejected(contents + '\0', true);
+
+	// A bad magic, version or byte order.
+	for (size_t offset : { size_t(0), offsetof(AutomatonImage::Header, version), offsetof(AutomatonImage::Header, byteOrder) })
+	{
+		std::string corrupt = contents;
+		corrupt[offset] ^= 0x40;
+		CheckRejected(corrupt, true);
+		CheckRejected(corrupt, false);
+	}
+
+	// A flipped byte in the checksum or anywhere in the payload is only caught by verify.
+	for (size_t offset = offsetof(AutomatonImage::Header, checksum); offset < contents.size(); ++offset)
+	{
+		std::string corrupt = contents;
+		corrupt[offset] ^= 0x01;
+		CheckRejected(corrupt, true);
+	}
+}
+
+// Payloads with a valid checksum that describe an impossible automaton.
+void TestInconsistentPayloads()
+{
+	CHECK(CompiledDFA(GetDFA()).Save(fileName));
+	const std::string contents = ReadFile();
+	const size_t headerSize = sizeof(AutomatonImage::Header);
+
+	auto reseal = [headerSize](std::string& image)
+	{
+		uint64_t checksum = AutomatonImage::Checksum(image.data() + headerSize, image.size() - headerSize);
+		std::memcpy(&image[offsetof(AutomatonImage::Header, checksum)], &checksum, sizeof(checksum));
+	};
+
+	// The counts are a uint32_t each for the states, classes, initial state and first live
+	// state, then a uint64_t for the size of the names; the byte classes follow at offset 24.
+	const size_t namesSize = headerSize + 16, byteClasses = headerSize + 24, transitions = byteClasses + 256;
+
+	// A size of the names past the end of the file, which would make the layout overflow.
+	for (uint64_t size : { uint64_t(contents.size()), ~uint64_t(0) - 16, ~uint64_t(0) })
+	{
+		std::string corrupt = contents;
+		std::memcpy(&corrupt[namesSize], &size, sizeof(size));
+		CheckRejected(corrupt, false);
+		reseal(corrupt);
+		CheckRejected(corrupt, true);
+	}
+
+	// A state id and a byte class out of range, and a dead state that leaves itself.
+	uint32_t numberOfStates;
+	std::memcpy(&numberOfStates, &contents[headerSize], sizeof(numberOfStates));
+	std::string badTarget = contents;
+	uint32_t target = numberOfStates;
+	std::memcpy(&badTarget[transitions + sizeof(uint32_t) * 2 * 2], &target, sizeof(target));
+	std::string badClass = contents;
+	badClass[byteClasses + 'a'] = char(200);
+	std::string liveDeadState = contents;
+	target = 1;
+	std::memcpy(&liveDeadState[transitions], &target, sizeof(target));
+	for (auto* corrupt : { &badTarget, &badClass, &liveDeadState })
+	{
+		reseal(*corrupt);
+		CheckRejected(*corrupt, true);
+	}
+}
+
+int main()
+{
+	TestRoundTrip();
+	TestCorruptFiles();
+	TestInconsistentPayloads();
+	std::filesystem::remove(fileName);
+
+	return failures != 0;
+}
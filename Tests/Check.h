@@ -0,0 +1,15 @@
+#pragma once
+#include <iostream>
+
+// A failed check is printed with where it happened, and main returns 1 if any check failed.
+inline size_t failures = 0;
+
+#define CHECK(condition) \
+	do \
+	{ \
+		if (!(condition)) \
+		{ \
+			std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed\n"; \
+			++failures; \
+		} \
+	} while (false)
@@ -0,0 +1,56 @@
+#include "TestAutomata.h"
+#include "CompiledDFA.h"
+
+// Lengths of 0 to maxLength, so that a batch has empty words and words on both sides of
+// the length from which words are interleaved instead of run in lockstep.
+std::vector<std::string> RandomWords(Random& random, const std::string& symbols, size_t count, size_t maxLength)
+{
+	std::vector<std::string> words;
+	for (size_t index = 0; index < count; ++index)
+		words.push_back(RandomWord(random, symbols, maxLength));
+	return words;
+}
+
+// The batch kernels give the same results as matching the words one at a time. The short
+// words are run in lockstep only on a table too large for the cache, so the DFAs are of both
+// sizes; every state has a missing transition now and then, so words also end in the dead state.
+void TestBatches(Random& random, size_t numberOfStates)
+{
+	const std::string symbols = "abcdefgh";
+	DFA DFA = RandomDFA(random, numberOfStates, symbols, 0.97);
+	CompiledDFA compiledDFA(DFA);
+
+	for (size_t maxLength : { 0, 1, 3, 15, 16, 17, 100 })
+		for (size_t count : { 1, 15, 16, 17, 1000 })
+		{
+			// A symbol outside the alphabet now and then.
+			std::vector<std::string> words = RandomWords(random, maxLength % 2 ? symbols : symbols + "z", count, maxLength);
+			std::vector<size_t> expected;
+			for (const auto& word : words)
+				expected.push_back(compiledDFA.Accepts(word));
+
+			CHECK(compiledDFA.Accepts(words) == expected);
+			CHECK(compiledDFA.Accepts(words, 3) == expected);
+		}
+
+	for (size_t round = 0; round < 20; ++round)
+	{
+		std::vector<std::string> words = RandomWords(random, symbols, 500, 40);
+		std::string lines;
+		for (size_t index = 0; index < words.size(); ++index)
+		{
+			CHECK(compiledDFA.Accepts(words[index]) == DFA.Accepts(words[index]));
+			lines += words[index] + (index % 2 ? "\r\n" : "\n");
+		}
+		CHECK(compiledDFA.AcceptsLines(lines) == compiledDFA.Accepts(words));
+	}
+}
+
+int main()
+{
+	Random random(6);
+	for (size_t numberOfStates : { 1, 2, 16, 1000, 40000 })
+		TestBatches(random, numberOfStates);
+
+	return failures != 0;
+}
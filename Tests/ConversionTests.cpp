@@ -0,0 +1,78 @@
+#include "Minimization.h"
+#include "TestAutomata.h"
+
+// The subset DFA does not depend on the number of threads, whatever the batches it is computed in.
+void TestThreads(Random& random, size_t numberOfStates, bool withLambda)
+{
+	for (size_t round = 0; round < 10; ++round)
+	{
+		NFA NFA = RandomNFA(random, numberOfStates, "ab", 3, withLambda);
+		std::string definition = GetDefinition(NFA::ConvertToDFA(NFA, 1));
+		for (size_t numberOfThreads : { 2, 3, 8 })
+			CHECK(GetDefinition(NFA::ConvertToDFA(NFA, numberOfThreads)) == definition);
+	}
+}
+
+// The limits stop the construction with the progress so far.
+void TestLimits(Random& random)
+{
+	NFA NFA = RandomNFA(random, 20, "ab", 3);
+	size_t numberOfStates = NFA::ConvertToDFA(NFA).GetStates().size();
+
+	ConversionOptions options;
+	size_t calls = 0;
+	options.progress = [&calls](const ConversionProgress&) { ++calls; };
+	options.maxStates = numberOfStates;
+	CHECK(NFA::ConvertToDFA(NFA, options).GetStates().size() == numberOfStates);
+	CHECK(calls > 0);
+
+	options.maxStates = numberOfStates - 1;
+	bool thrown = false;
+	try
+	{
+		NFA::ConvertToDFA(NFA, options);
+	}
+	catch (const ConversionError& error)
+	{
+		thrown = true;
+		CHECK(error.GetProgress().numberOfSubsets == numberOfStates - 1);
+	}
+	CHECK(thrown);
+}
+
+// Brzozowski's algorithm gives the minimal DFA. The NFAs have few final states, so most of
+// them have dead states, from which the subset DFA gets dead subsets that are not empty.
+void TestBrzozowski(Random& random, size_t numberOfStates, bool withLambda)
+{
+	ConversionOptions options;
+	options.minimize = true;
+	for (size_t round = 0; round < 30; ++round)
+	{
+		NFA NFA = RandomNFA(random, numberOfStates, "ab", 2, withLambda, 0.1);
+		DFA expected = NFA::ConvertToDFA(NFA);
+		DFA::Minimize(expected, MinimizationAlgorithm::Hopcroft);
+		DFA minimal = NFA::ConvertToDFA(NFA, options);
+		CHECK(AreIsomorphic(minimal, expected));
+
+		for (size_t index = 0; index < 50; ++index)
+		{
+			std::string word = RandomWord(random, "ab", 20);
+			CHECK((minimal.Accepts(word) == 1) == NFA.Accepts(word));
+		}
+	}
+}
+
+int main()
+{
+	Random random(2);
+	for (size_t numberOfStates : { 1, 10, 40 })
+	{
+		TestThreads(random, numberOfStates, false);
+		TestThreads(random, numberOfStates, true);
+		TestBrzozowski(random, numberOfStates, false);
+		TestBrzozowski(random, numberOfStates, true);
+	}
+	TestLimits(random);
+
+	return failures != 0;
+}
@@ -0,0 +1,120 @@
+#include "Check.h"
+#include "DFA.h"
+#include "ElementsParser.h"
+#include "NFA.h"
+#include <sstream>
+
+ElementsParser GetParser(const std::string& text)
+{
+	return ElementsParser(text.data(), text.data() + text.size());
+}
+
+void TestTokens()
+{
+	std::string text = "3\r\nstart\tmiddle_state  q1000000\n\n  a - 42\n";
+	ElementsParser parser = GetParser(text);
+	CHECK(parser.ReadCount() == 3);
+	CHECK(parser.ReadName() == "start");
+	CHECK(parser.ReadName() == "middle_state");
+	CHECK(!parser.AtLineEnd());
+	CHECK(parser.ReadName() == "q1000000");
+	CHECK(parser.AtLineEnd());
+	CHECK(parser.ReadSymbol() == 'a');
+	CHECK(parser.ReadName() == "-");
+	CHECK(parser.ReadCount() == 42);
+	CHECK(parser.AtEnd());
+}
+
+// The symbols section is only recognized as a count, that many single characters and the count of transitions.
+void TestSymbolsSection()
+{
+	CHECK(GetParser("2\na b\n3\n").AtSymbols());
+	CHECK(GetParser("0\n\n0\n").AtSymbols());
+	CHECK(!GetParser("3\nq0 a q1\n").AtSymbols());
+	CHECK(!GetParser("2\na bc\n3\n").AtSymbols());
+	CHECK(!GetParser("2\na b c\n3\n").AtSymbols());
+	CHECK(!GetParser("2\na b\nq0 a q1\n").AtSymbols());
+
+	// Looking ahead does not consume anything.
+	ElementsParser parser = GetParser("2\na b\n3\n");
+	CHECK(parser.AtSymbols());
+	CHECK(parser.ReadCount() == 2);
+}
+
+// Names of any length, with and without a symbols section, read to the same DFA.
+void TestLongNames()
+{
+	std::string states = "3\nstart q_10 accepting\n";
+	std::string transitions = "4\nstart a q_10\nq_10 b q_10\nq_10 a accepting\naccepting a -\nstart\n1\naccepting\n";
+	for (const auto& description : { states + transitions, states + "2\na b\n" + transitions })
+	{
+		std::istringstream in(description);
+		DFA DFA;
+		in >> DFA;
+		CHECK(DFA.GetStates().size() == 3);
+		CHECK(DFA.GetStateName(DFA.GetInitialState()) == "start");
+		CHECK(DFA.GetStateId("q_10") != DFA::noState);
+		CHECK(DFA.GetTransition(DFA.GetStateId("accepting"), 'a') == DFA::noState);
+		CHECK(DFA.Accepts("abba") == 1);
+		CHECK(DFA.Accepts("ab") == 0);
+	}
+}
+
+// Where the first token that does not fit the format starts.
+template<class Automaton>
+std::pair<size_t, size_t> GetErrorPosition(const std::string& description)
+{
+	std::istringstream in(description);
+	Automaton automaton;
+	try
+	{
+		in >> automaton;
+	}
+	catch (const ParseError& error)
+	{
+		return std::make_pair(error.GetLine(), error.GetColumn());
+	}
+	return std::make_pair(size_t(0), size_t(0));
+}
+
+void TestErrorPositions()
+{
+	using Position = std::pair<size_t, size_t>;
+	// A missing count of states.
+	CHECK(GetErrorPosition<DFA>("q0 q1\n") == Position(1, 1));
+	// A symbol of two characters, at its first one.
+	CHECK(GetErrorPosition<DFA>("2\nq0 q1\n1\nq0 ab q1\nq0\n0\n") == Position(4, 4));
+	// A count with a letter in it.
+	CHECK(GetErrorPosition<DFA>("2\nq0 q1\n1\nq0 a q1\nq0\n1x\n") == Position(6, 1));
+	// The input ends before the final states, on a line with carriage returns.
+	CHECK(GetErrorPosition<DFA>("2\r\nq0 q1\r\n1\r\nq0 a q1\r\nq0\r\n2\r\nq1") == Position(7, 3));
+	// A line of an NFA with no next state.
+	CHECK(GetErrorPosition<NFA>("2\nq0 q1\n1\n  q0 a\nq0\n0\n") == Position(4, 7));
+	CHECK(GetErrorPosition<DFA>("2\nq0 q1\n1\nq0 a q1\nq0\n1\nq1\n") == Position(0, 0));
+}
+
+void TestCountOverflow()
+{
+	ElementsParser parser = GetParser("99999999999999999999999 ");
+	bool failed = false;
+	try
+	{
+		parser.ReadCount();
+	}
+	catch (const ParseError& error)
+	{
+		failed = error.GetLine() == 1 && error.GetColumn() == 1;
+	}
+	CHECK(failed);
+}
+
+int main()
+{
+	TestTokens();
+	TestSymbolsSection();
+	TestLongNames();
+	TestErrorPositions();
+	TestCountOverflow();
+
+	return failures != 0;
+}
@@ -0,0 +1,138 @@
+#include "Check.h"
+#include "DFA.h"
+#include "FlatHashMap.h"
+#include <map>
+#include <random>
+
+// Four keys in a row share their slot, so clusters run into each other and wrap around the table.
+class CollidingHash
+{
+public:
+	std::size_t operator()(uint32_t key) const
+	{
+		return key / 4;
+	}
+};
+
+template<class Hasher>
+bool Equals(const FlatHashMap<uint32_t, uint32_t, Hasher>& map, const std::map<uint32_t, uint32_t>& expected)
+{
+	if (map.size() != expected.size())
+		return false;
+	for (const auto& [key, value] : expected)
+	{
+		auto it = map.find(key);
+		if (it == map.end() || it->second != value)
+			return false;
+	}
+	size_t numberOfEntries = 0;
+	for (const auto& [key, value] : map)
+	{
+		auto it = expected.find(key);
+		if (it == expected.end() || it->second != value)
+			return false;
+		++numberOfEntries;
+	}
+	return numberOfEntries == expected.size();
+}
+
+// Random inserts, assignments and erases over a few keys, so that erasing keeps shifting
+// entries back across clusters, checked against std::map after every operation.
+template<class Hasher>
+void TestAgainstMap(uint32_t numberOfKeys)
+{
+	std::mt19937 generator(numberOfKeys);
+	FlatHashMap<uint32_t, uint32_t, Hasher> map;
+	std::map<uint32_t, uint32_t> expected;
+	bool equal = true;
+	for (size_t step = 0; step < 20000 && equal; ++step)
+	{
+		uint32_t key = generator() % numberOfKeys, value = generator();
+		switch (generator() % 4)
+		{
+		case 0:
+			CHECK(map.insert(std::make_pair(key, value)) == expected.insert(std::make_pair(key, value)).second);
+			break;
+		case 1:
+			map[key] = value;
+			expected[key] = value;
+			break;
+		default:
+			CHECK(map.erase(key) == expected.erase(key));
+			break;
+		}
+		equal = Equals(map, expected);
+
+		// Emptying the map now and then makes it fill up and rehash again.
+		if (step % 5000 == 4999)
+		{
+			for (uint32_t key = 0; key < numberOfKeys; ++key)
+				CHECK(map.erase(key) == expected.erase(key));
+			CHECK(map.empty());
+		}
+	}
+	CHECK(equal);
+
+	map.clear();
+	CHECK(map.empty());
+	CHECK(map.begin() == map.end());
+	CHECK(map.find(0) == map.end());
+	CHECK(map.erase(0) == 0);
+}
+
+void TestReserve()
+{
+	FlatHashMap<uint32_t, uint32_t, CollidingHash> map;
+	map.reserve(100);
+	for (uint32_t key = 0; key < 100; ++key)
+		map[key] = key * 2;
+	// Reserving no more than is there does not rehash or lose anything.
+	map.reserve(10);
+	CHECK(map.size() == 100);
+	for (uint32_t key = 0; key < 100; ++key)
+		CHECK(map.find(key)->second == key * 2);
+}
+
+// (state, symbol) keys as in a transition table: lookups of keys that are there and of
+// symbols that are not both read only a few slots.
+void TestProbeLengths()
+{
+	using Key = std::pair<uint32_t, unsigned char>;
+	FlatHashMap<Key, uint32_t, Hash> map;
+	CHECK(map.GetProbeLength(Key(0, 'a')) == 0);
+
+	const uint32_t numberOfStates = 50000;
+	for (uint32_t state = 0; state < numberOfStates; ++state)
+		for (unsigned char symbol = 'a'; symbol <= 'd'; ++symbol)
+			map[Key(state, symbol)] = state;
+
+	size_t hits = 0, misses = 0, maxHit = 0;
+	for (uint32_t state = 0; state < numberOfStates; ++state)
+	{
+		for (unsigned char symbol = 'a'; symbol <= 'd'; ++symbol)
+		{
+			size_t length = map.GetProbeLength(Key(state, symbol));
+			hits += length;
+			maxHit = std::max(maxHit, length);
+		}
+		misses += map.GetProbeLength(Key(state, 'e'));
+	}
+
+	CHECK(map.GetProbeLength(Key(0, 'a')) >= 1);
+	CHECK(hits < map.size() * 3);
+	CHECK(misses < numberOfStates * 10);
+	CHECK(maxHit < 64);
+}
+
+int main()
+{
+	for (uint32_t numberOfKeys : { 4, 12, 40, 300 })
+	{
+		TestAgainstMap<CollidingHash>(numberOfKeys);
+		TestAgainstMap<std::hash<uint32_t>>(numberOfKeys);
+	}
+	TestReserve();
+	TestProbeLengths();
+
+	return failures != 0;
+}
@@ -0,0 +1,117 @@
+#include "Check.h"
+#include "DFA.h"
+#include "ElementsParser.h"
+#include "NFA.h"
+#include <sstream>
+
+DFA ReadDFA(const std::string& description)
+{
+	std::istringstream in(description);
+	DFA DFA;
+	in >> DFA;
+	return DFA;
+}
+
+NFA ReadNFA(const std::string& description)
+{
+	std::istringstream in(description);
+	NFA NFA;
+	in >> NFA;
+	return NFA;
+}
+
+template<class Automaton>
+std::string Write(const Automaton& automaton)
+{
+	std::ostringstream out;
+	out << automaton;
+	return out.str();
+}
+
+// DFA::Accepts is 1 for an accepted word, 0 for a rejected one and size_t(-1) for one
+// that runs into a missing transition.
+
+// The format of the former DFA program: no symbols section.
+void TestDFAWithoutSymbols()
+{
+	DFA DFA = ReadDFA("2\nq0 q1\n3\nq0 a q1\nq1 a q1\nq1 b q0\nq0\n1\nq1\n");
+	CHECK(DFA.GetStates().size() == 2);
+	CHECK(DFA.GetSymbols() == std::set<DFA::Symbol>({ 'a', 'b' }));
+	CHECK(DFA.GetTransition(DFA.GetInitialState(), 'b') == DFA::noState);
+	CHECK(DFA.Accepts("a") == 1);
+	CHECK(DFA.Accepts("aaba") == 1);
+	CHECK(DFA.Accepts("ab") == 0);
+	CHECK(DFA.Accepts("b") == size_t(-1));
+}
+
+// The format of the former minimization program: a symbols section, and "-" for a missing transition.
+void TestDFAWithSymbols()
+{
+	DFA DFA = ReadDFA("3\nq0 q1 q2\n3\na b c\n3\nq0 a q1\nq0 b -\nq1 c q2\nq0\n1\nq2\n");
+	CHECK(DFA.GetSymbols() == std::set<DFA::Symbol>({ 'a', 'b', 'c' }));
+	CHECK(DFA.GetTransition(DFA.GetInitialState(), 'b') == DFA::noState);
+	CHECK(DFA.Accepts("ac") == 1);
+	CHECK(DFA.Accepts("bc") == size_t(-1));
+}
+
+// What operator<< writes reads back as the same automaton.
+void TestDFARoundTrip()
+{
+	DFA DFA1 = ReadDFA("3\nq0 q1 q2\n3\na b c\n4\nq0 a q1\nq1 b q1\nq1 c q2\nq2 a q0\nq0\n2\nq0 q2\n");
+	std::string description = Write(DFA1);
+	DFA DFA2 = ReadDFA(description);
+	CHECK(Write(DFA2) == description);
+	for (const std::string word : { "", "a", "ac", "abbc", "acaabc", "b" })
+		CHECK(DFA1.Accepts(word) == DFA2.Accepts(word));
+}
+
+// The format of the former NFA program: several next states on one line, each a transition.
+void TestNFAWithSeveralTargets()
+{
+	NFA NFA = ReadNFA("3\nq0 q1 q2\n4\nq0 a q0 q1\nq1 b q1 q2\nq0\n1\nq2\n");
+	CHECK(NFA.GetTransitions(NFA.GetInitialState(), 'a').size() == 2);
+	CHECK(NFA.Accepts("ab"));
+	CHECK(NFA.Accepts("aaabbb"));
+	CHECK(!NFA.Accepts("a"));
+	CHECK(!NFA.Accepts("ba"));
+
+	std::string description = Write(NFA);
+	CHECK(Write(ReadNFA(description)) == description);
+}
+
+void TestNFAWithTooManyTargets()
+{
+	bool failed = false;
+	try
+	{
+		ReadNFA("2\nq0 q1\n1\nq0 a q0 q1\nq0\n1\nq1\n");
+	}
+	catch (const ParseError& error)
+	{
+		failed = error.GetLine() == 4;
+	}
+	CHECK(failed);
+}
+
+// Several descriptions can follow each other in one stream.
+void TestConsecutiveDescriptions()
+{
+	std::istringstream in("1\nq0\n1\nq0 a q0\nq0\n1\nq0\n\n1\np\n1\np b p\np\n0\n");
+	DFA DFA1, DFA2;
+	in >> DFA1 >> DFA2;
+	CHECK(DFA1.Accepts("aa") == 1);
+	CHECK(DFA2.Accepts("bb") == 0);
+	CHECK(DFA2.GetSymbols() == std::set<DFA::Symbol>({ 'b' }));
+}
+
+int main()
+{
+	TestDFAWithoutSymbols();
+	TestDFAWithSymbols();
+	TestDFARoundTrip();
+	TestNFAWithSeveralTargets();
+	TestNFAWithTooManyTargets();
+	TestConsecutiveDescriptions();
+
+	return failures != 0;
+}
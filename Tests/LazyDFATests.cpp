@@ -0,0 +1,121 @@
+#include "Check.h"
+#include "LazyDFA.h"
+
+const size_t k = 8;
+
+// The k-th symbol from the end is an a: k + 1 states, but 2^k subsets reachable.
+NFA GetNFA()
+{
+	NFA NFA;
+	std::vector<NFA::StateId> states;
+	for (size_t index = 0; index <= k; ++index)
+		states.push_back(NFA.InsertState("q" + std::to_string(index)));
+	NFA.InsertSymbol('a');
+	NFA.InsertSymbol('b');
+
+	NFA.SetInitialState(states[0]);
+	NFA.InsertTransition(std::make_pair(states[0], 'a'), states[0]);
+	NFA.InsertTransition(std::make_pair(states[0], 'b'), states[0]);
+	NFA.InsertTransition(std::make_pair(states[0], 'a'), states[1]);
+	for (size_t index = 1; index < k; ++index)
+	{
+		NFA.InsertTransition(std::make_pair(states[index], 'a'), states[index + 1]);
+		NFA.InsertTransition(std::make_pair(states[index], 'b'), states[index + 1]);
+	}
+	NFA.InsertFinalState(states[k]);
+	return NFA;
+}
+
+bool IsAccepted(const std::string& word)
+{
+	return word.find_first_not_of("ab") == std::string::npos && word.size() >= k && word[word.size() - k] == 'a';
+}
+
+// Every word over {a, b} up to the given length, long words that visit many subsets, and
+// words with a symbol the NFA does not have.
+std::vector<std::string> GetWords(size_t maxLength)
+{
+	std::vector<std::string> words(1);
+	for (size_t index = 0; words[index].size() < maxLength; ++index)
+	{
+		words.push_back(words[index] + 'a');
+		words.push_back(words[index] + 'b');
+	}
+
+	uint32_t bits = 12345;
+	for (size_t length : { 100, 1000, 5000 })
+	{
+		std::string word;
+		for (size_t index = 0; index < length; ++index)
+		{
+			bits = bits * 1103515245 + 12345;
+			word += (bits >> 16) & 1 ? 'a' : 'b';
+		}
+		words.push_back(word);
+	}
+	words.push_back(std::string(2000, 'a') + "bc");
+	words.push_back("c");
+	return words;
+}
+
+// With room for every subset, the cache ends up as the subset DFA and is never cleared.
+void TestUnbounded()
+{
+	LazyDFA lazyDFA(GetNFA(), size_t(1) << 30);
+	for (const auto& word : GetWords(10))
+		CHECK(lazyDFA.Accepts(word) == IsAccepted(word));
+
+	CHECK(lazyDFA.GetNumberOfResets() == 0);
+	CHECK(lazyDFA.GetNumberOfFallbacks() == 0);
+	CHECK(lazyDFA.GetNumberOfStates() == (size_t(1) << k));
+
+	// Known paths do not compute anything again.
+	size_t numberOfStates = lazyDFA.GetNumberOfStates(), memoryUsage = lazyDFA.GetMemoryUsage();
+	for (const auto& word : GetWords(10))
+		CHECK(lazyDFA.Accepts(word) == IsAccepted(word));
+	CHECK(lazyDFA.GetNumberOfStates() == numberOfStates);
+	CHECK(lazyDFA.GetMemoryUsage() == memoryUsage);
+
+	lazyDFA.Reset();
+	CHECK(lazyDFA.GetNumberOfStates() == 0);
+	CHECK(lazyDFA.GetMemoryUsage() == 0);
+	CHECK(lazyDFA.Accepts("abbbbbbb"));
+}
+
+// A cache too small for the subset DFA is cleared as it fills up and stays about under its limit.
+void TestBounded()
+{
+	for (size_t memoryLimit : { 0, 256, 4096, 16384 })
+	{
+		LazyDFA lazyDFA(GetNFA(), memoryLimit);
+		size_t maxMemoryUsage = 0;
+		for (const auto& word : GetWords(10))
+		{
+			CHECK(lazyDFA.Accepts(word) == IsAccepted(word));
+			maxMemoryUsage = std::max(maxMemoryUsage, lazyDFA.GetMemoryUsage());
+		}
+
+		CHECK(lazyDFA.GetNumberOfResets() > 0);
+		// A subset is added once the limit is reached only after clearing the cache.
+		CHECK(maxMemoryUsage < memoryLimit + 256);
+	}
+}
+
+// When the cache is cleared more often than every symbolsPerMiss symbols, the word is
+// finished on the NFA.
+void TestFallback()
+{
+	LazyDFA lazyDFA(GetNFA(), 0);
+	for (const auto& word : GetWords(4))
+		CHECK(lazyDFA.Accepts(word) == IsAccepted(word));
+	CHECK(lazyDFA.GetNumberOfFallbacks() > 0);
+}
+
+int main()
+{
+	TestUnbounded();
+	TestBounded();
+	TestFallback();
+
+	return failures != 0;
+}
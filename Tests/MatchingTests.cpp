@@ -0,0 +1,58 @@
+#include "TestAutomata.h"
+#include "BitParallelNFA.h"
+#include "CompiledNFA.h"
+#include "LazyDFA.h"
+#include <optional>
+
+// Every matcher of an NFA gives the same answer as NFA::Accepts, and so does its subset DFA
+// when it is small enough to be built.
+void TestMatchers(Random& random, size_t numberOfStates, bool withLambda)
+{
+	const std::string symbols = "abc";
+	for (size_t round = 0; round < 20; ++round)
+	{
+		NFA NFA = RandomNFA(random, numberOfStates, symbols, 2, withLambda);
+		CompiledNFA compiledNFA(NFA);
+		LazyDFA lazyDFA(NFA);
+		// Small enough to be cleared and to give up on the cache for long words.
+		LazyDFA smallLazyDFA(NFA, 2048);
+		bool bitParallel = BitParallelNFA::Supports(NFA);
+		BitParallelNFA bitParallelNFA = bitParallel ? BitParallelNFA(NFA) : BitParallelNFA(::NFA());
+		ConversionOptions options;
+		options.maxStates = 4096;
+		std::optional<DFA> DFA;
+		try
+		{
+			DFA = NFA::ConvertToDFA(NFA, options);
+		}
+		catch (const ConversionError&)
+		{
+		}
+
+		for (size_t index = 0; index < 200; ++index)
+		{
+			// A symbol outside the alphabet now and then.
+			std::string word = RandomWord(random, index % 10 ? symbols : symbols + "z", 40);
+			bool accepted = NFA.Accepts(word);
+			CHECK(compiledNFA.Accepts(word) == accepted);
+			CHECK(lazyDFA.Accepts(word) == accepted);
+			CHECK(smallLazyDFA.Accepts(word) == accepted);
+			if (bitParallel)
+				CHECK(bitParallelNFA.Accepts(word) == accepted);
+			if (DFA)
+				CHECK((DFA->Accepts(word) == 1) == accepted);
+		}
+	}
+}
+
+int main()
+{
+	Random random(1);
+	for (size_t numberOfStates : { size_t(1), size_t(5), size_t(20), size_t(64), size_t(65), size_t(200), BitParallelNFA::maxStates, BitParallelNFA::maxStates + 1 })
+	{
+		TestMatchers(random, numberOfStates, false);
+		TestMatchers(random, numberOfStates, true);
+	}
+
+	return failures != 0;
+}
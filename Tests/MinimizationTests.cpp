@@ -0,0 +1,156 @@
+#include "TestAutomata.h"
+#include "Minimization.h"
+#include <set>
+
+// The three methods give the same DFA, state for state, and it accepts the same words.
+void TestMethods(Random& random, size_t numberOfStates, const std::string& symbols)
+{
+	for (size_t round = 0; round < 20; ++round)
+	{
+		DFA original = RandomDFA(random, numberOfStates, symbols);
+		DFA tableFilling = original, hopcroft = original, parallelRefinement = original;
+		MinimizationReport report = DFA::Minimize(tableFilling, MinimizationAlgorithm::TableFilling);
+		DFA::Minimize(hopcroft, MinimizationAlgorithm::Hopcroft);
+		DFA::Minimize(parallelRefinement, MinimizationAlgorithm::ParallelRefinement);
+
+		std::string definition = GetDefinition(tableFilling);
+		CHECK(GetDefinition(hopcroft) == definition);
+		CHECK(GetDefinition(parallelRefinement) == definition);
+		CHECK(report.numberOfClasses == tableFilling.GetStates().size());
+
+		for (size_t index = 0; index < 100; ++index)
+		{
+			std::string word = RandomWord(random, symbols, 20);
+			CHECK((tableFilling.Accepts(word) == 1) == (original.Accepts(word) == 1));
+		}
+
+		// A minimal DFA stays as it is.
+		DFA minimized = tableFilling;
+		DFA::Minimize(minimized, MinimizationAlgorithm::Hopcroft);
+		CHECK(GetDefinition(minimized) == definition);
+	}
+}
+
+// The parallel refinement gives the DFA of Hopcroft's algorithm whatever the number of threads,
+// also when there are more threads than states.
+void TestThreads(Random& random, size_t numberOfStates, const std::string& symbols)
+{
+	for (size_t round = 0; round < 5; ++round)
+	{
+		DFA hopcroft = RandomDFA(random, numberOfStates, symbols, 0.9, 0.5);
+		DFA original = hopcroft;
+		Minimization().HopcroftMethod(hopcroft);
+		std::string definition = GetDefinition(hopcroft);
+
+		for (size_t numberOfThreads : { 1, 2, 3, 8 })
+		{
+			DFA parallelRefinement = original;
+			Minimization(nullptr, numberOfThreads).ParallelRefinementMethod(parallelRefinement);
+			CHECK(GetDefinition(parallelRefinement) == definition);
+		}
+	}
+}
+
+// One Minimization used for many DFAs gives the same DFAs as a new one for each of them.
+void TestReuse(Random& random)
+{
+	Minimization minimization;
+	for (size_t round = 0; round < 30; ++round)
+	{
+		DFA DFA1 = RandomDFA(random, 1 + round % 12, "ab"), DFA2 = DFA1;
+		MinimizationReport report;
+		switch (round % 3)
+		{
+		case 0:
+			report = minimization.TableFillingMethod(DFA1);
+			break;
+		case 1:
+			report = minimization.HopcroftMethod(DFA1);
+			break;
+		case 2:
+			report = minimization.ParallelRefinementMethod(DFA1);
+		}
+		MinimizationReport expected = DFA::Minimize(DFA2, static_cast<MinimizationAlgorithm>(round % 3));
+
+		CHECK(GetDefinition(DFA1) == GetDefinition(DFA2));
+		CHECK(report.unreachableStates == expected.unreachableStates);
+		CHECK(report.trapState == expected.trapState);
+		CHECK(report.numberOfClasses == expected.numberOfClasses);
+		CHECK(report.numberOfIterations == expected.numberOfIterations);
+	}
+}
+
+// TakeNext gives back the marked pairs once each, row after row, and unmarks them.
+void TestPairTable(Random& random)
+{
+	for (uint32_t numberOfStates : { 2, 3, 65, 3000 })
+	{
+		PairTable pairTable(numberOfStates);
+		std::set<std::pair<uint32_t, uint32_t>> marked;
+		std::uniform_int_distribution<uint32_t> anyState(0, numberOfStates - 1);
+		for (size_t index = 0; index < numberOfStates * 4; ++index)
+		{
+			uint32_t state1 = anyState(random), state2 = anyState(random);
+			if (state1 == state2)
+				continue;
+			if (state1 < state2)
+				std::swap(state1, state2);
+			CHECK(pairTable.Mark(state1, state2) == marked.insert(std::make_pair(state1, state2)).second);
+		}
+		// The last pair, at the end of the last word used.
+		pairTable.Mark(numberOfStates - 1, numberOfStates - 2);
+		marked.insert(std::make_pair(numberOfStates - 1, numberOfStates - 2));
+
+		using Pairs = std::vector<std::pair<uint32_t, uint32_t>>;
+		Pairs taken;
+		size_t index = 0;
+		uint32_t state1, state2;
+		while (pairTable.TakeNext(index, state1, state2))
+		{
+			CHECK(!pairTable.IsMarked(state1, state2));
+			taken.emplace_back(state1, state2);
+		}
+		CHECK(taken == Pairs(marked.begin(), marked.end()));
+		index = 0;
+		CHECK(!pairTable.TakeNext(index, state1, state2));
+	}
+}
+
+// A DFA with no initial state accepts nothing, with or without states, and minimizes to the empty DFA.
+void TestNoInitialState(Random& random)
+{
+	for (size_t numberOfStates : { 0, 1, 10 })
+		for (size_t algorithm = 0; algorithm < 3; ++algorithm)
+		{
+			DFA DFA;
+			if (numberOfStates != 0)
+			{
+				DFA = RandomDFA(random, numberOfStates, "ab");
+				DFA.SetInitialState(DFA::noState);
+			}
+			MinimizationReport report = DFA::Minimize(DFA, static_cast<MinimizationAlgorithm>(algorithm));
+			CHECK(DFA.GetStates().empty());
+			CHECK(DFA.GetTransitionTable().empty());
+			CHECK(DFA.GetInitialState() == DFA::noState);
+			CHECK(report.unreachableStates == numberOfStates);
+			CHECK(report.numberOfClasses == 0);
+		}
+}
+
+int main()
+{
+	Random random(3);
+	for (size_t numberOfStates : { 1, 2, 8, 30, 100 })
+	{
+		TestMethods(random, numberOfStates, "a");
+		TestMethods(random, numberOfStates, "ab");
+		TestMethods(random, numberOfStates, "abcd");
+	}
+	for (size_t numberOfStates : { 1, 5, 1000, 20000 })
+		TestThreads(random, numberOfStates, "abc");
+	TestReuse(random);
+	TestPairTable(random);
+	TestNoInitialState(random);
+
+	return failures != 0;
+}
@@ -0,0 +1,84 @@
+#include "Check.h"
+#include "Parallel.h"
+#include <atomic>
+#include <stdexcept>
+
+// Every index is run exactly once, for any count and number of threads.
+void TestCoverage()
+{
+	for (size_t count : { 0, 1, 2, 7, 64, 1000 })
+		for (size_t numberOfThreads : { 0, 1, 2, 3, 8, 100 })
+		{
+			std::vector<std::atomic<int>> runs(count);
+			ParallelFor(count, numberOfThreads, [&](size_t begin, size_t end)
+				{
+					CHECK(begin < end && end <= count);
+					for (size_t index = begin; index < end; ++index)
+						++runs[index];
+				});
+			for (const auto& run : runs)
+				CHECK(run == 1);
+		}
+}
+
+// The threads are started once, not for every call.
+void TestReuse()
+{
+	std::atomic<size_t> sum = 0;
+	ParallelFor(8, 8, [&](size_t begin, size_t end) { sum += end - begin; });
+	size_t numberOfWorkers = ThreadPool::GetInstance().GetNumberOfWorkers();
+	CHECK(numberOfWorkers >= 7);
+
+	for (size_t round = 0; round < 1000; ++round)
+		ParallelFor(8, 8, [&](size_t begin, size_t end) { sum += end - begin; });
+	CHECK(sum == 1001 * 8);
+	CHECK(ThreadPool::GetInstance().GetNumberOfWorkers() == numberOfWorkers);
+}
+
+// A ParallelFor inside another one runs on the thread that calls it.
+void TestNested()
+{
+	std::atomic<size_t> sum = 0;
+	ParallelFor(4, 4, [&](size_t begin, size_t end)
+		{
+			for (size_t index = begin; index < end; ++index)
+				ParallelFor(10, 4, [&](size_t first, size_t last) { sum += last - first; });
+		});
+	CHECK(sum == 40);
+}
+
+// An exception thrown by a shard comes out of ParallelFor, and the pool still works after it.
+void TestException()
+{
+	for (size_t throwingShard : { 0, 3 })
+	{
+		bool thrown = false;
+		try
+		{
+			ParallelFor(4, 4, [&](size_t begin, size_t)
+				{
+					if (begin == throwingShard)
+						throw std::runtime_error("shard");
+				});
+		}
+		catch (const std::runtime_error&)
+		{
+			thrown = true;
+		}
+		CHECK(thrown);
+	}
+
+	std::atomic<size_t> sum = 0;
+	ParallelFor(4, 4, [&](size_t begin, size_t end) { sum += end - begin; });
+	CHECK(sum == 4);
+}
+
+int main()
+{
+	TestCoverage();
+	TestReuse();
+	TestNested();
+	TestException();
+
+	return failures != 0;
+}
@@ -0,0 +1,111 @@
+#include "Check.h"
+#include "PatternSet.h"
+#include "Regex.h"
+#include <algorithm>
+
+const std::vector<std::string> patterns = { "abc", "a(b|c)*", "(a|b)*abb", "b+", "", "[a-c]*c", "ab", "x", "(ab|ba)*" };
+
+// Every word over {a, b, c, x} up to the given length.
+std::vector<std::string> GetWords(size_t maxLength)
+{
+	std::vector<std::string> words(1);
+	for (size_t index = 0; words[index].size() < maxLength; ++index)
+		for (const auto& symbol : { 'a', 'b', 'c', 'x' })
+			words.push_back(words[index] + symbol);
+	return words;
+}
+
+// The ids of the patterns that accept the word, each matched on its own.
+std::vector<PatternSet::PatternId> GetMatches(const std::vector<NFA>& NFAs, const std::string& word)
+{
+	std::vector<PatternSet::PatternId> matches;
+	for (PatternSet::PatternId pattern = 0; pattern < NFAs.size(); ++pattern)
+		if (NFAs[pattern].Accepts(word))
+			matches.push_back(pattern);
+	return matches;
+}
+
+PatternSet GetPatternSet(std::vector<NFA>& NFAs)
+{
+	PatternSet patternSet;
+	for (const auto& pattern : patterns)
+	{
+		NFAs.push_back(Regex(pattern).GetNFA());
+		CHECK(patternSet.Insert(NFAs.back()) == NFAs.size() - 1);
+	}
+
+	// A DFA is inserted as the NFA with the same transitions.
+	DFA DFA = Regex("c(a|b)").ToDFA();
+	NFAs.push_back(NFA::ConvertToNFA(DFA));
+	CHECK(patternSet.Insert(DFA) == NFAs.size() - 1);
+	return patternSet;
+}
+
+// With any limit on the number of states, the ids are those of the patterns matched one by one,
+// in order; past the limit the words are finished on the patterns.
+void TestMatch()
+{
+	std::vector<NFA> NFAs;
+	PatternSet patternSet = GetPatternSet(NFAs);
+	CHECK(patternSet.GetNumberOfPatterns() == NFAs.size());
+	const std::vector<std::string> words = GetWords(6);
+
+	for (size_t maxStates : { 1, 2, 3, 10, 1000 })
+	{
+		bool complete = patternSet.Compile(maxStates);
+		CHECK(complete == (maxStates >= 1000));
+		CHECK(patternSet.GetNumberOfStates() <= std::max<size_t>(maxStates, 2));
+
+		for (const auto& word : words)
+		{
+			std::vector<PatternSet::PatternId> matches = patternSet.Match(word);
+			CHECK(std::is_sorted(matches.begin(), matches.end()));
+			CHECK(matches == GetMatches(NFAs, word));
+		}
+	}
+
+	// Compiling again with the default limit gives the full subset DFA.
+	CHECK(patternSet.Compile());
+	size_t numberOfStates = patternSet.GetNumberOfStates();
+	CHECK(patternSet.Compile(numberOfStates));
+	CHECK(!patternSet.Compile(numberOfStates - 1));
+}
+
+void TestSpecificMatches()
+{
+	std::vector<NFA> NFAs;
+	PatternSet patternSet = GetPatternSet(NFAs);
+	CHECK(patternSet.Compile());
+
+	using Ids = std::vector<PatternSet::PatternId>;
+	CHECK(patternSet.Match("") == Ids({ 4, 8 }));
+	CHECK(patternSet.Match("ab") == Ids({ 1, 6, 8 }));
+	CHECK(patternSet.Match("abc") == Ids({ 0, 1, 5 }));
+	CHECK(patternSet.Match("abb") == Ids({ 1, 2 }));
+	CHECK(patternSet.Match("bbb") == Ids({ 3 }));
+	CHECK(patternSet.Match("ca") == Ids({ 9 }));
+	CHECK(patternSet.Match("x") == Ids({ 7 }));
+	CHECK(patternSet.Match("xx").empty());
+	// Symbols of no pattern.
+	CHECK(patternSet.Match("abz").empty());
+	CHECK(patternSet.Match(std::string(1, '\0')).empty());
+}
+
+void TestEmpty()
+{
+	PatternSet patternSet;
+	CHECK(patternSet.Match("a").empty());
+	CHECK(patternSet.Compile());
+	CHECK(patternSet.GetNumberOfPatterns() == 0);
+	CHECK(patternSet.Match("").empty());
+	CHECK(patternSet.Match("abc").empty());
+}
+
+int main()
+{
+	TestMatch();
+	TestSpecificMatches();
+	TestEmpty();
+
+	return failures != 0;
+}
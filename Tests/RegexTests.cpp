@@ -0,0 +1,120 @@
+#include "Check.h"
+#include "ElementsParser.h"
+#include "Regex.h"
+
+// The NFA, the subset DFA and the minimal DFA of the pattern all accept exactly the given words among these.
+void CheckLanguage(const std::string& pattern, const std::vector<std::string>& accepted, const std::vector<std::string>& rejected)
+{
+	Regex regex(pattern);
+	CHECK(regex.GetPattern() == pattern);
+	DFA DFA = regex.ToDFA(false), minimalDFA = regex.ToDFA();
+	// Minimizing may add a trap state to complete the DFA.
+	CHECK(minimalDFA.GetStates().size() <= DFA.GetStates().size() + 1);
+
+	for (const auto& word : accepted)
+	{
+		CHECK(regex.GetNFA().Accepts(word));
+		CHECK(DFA.Accepts(word) == 1);
+		CHECK(minimalDFA.Accepts(word) == 1);
+	}
+	for (const auto& word : rejected)
+	{
+		CHECK(!regex.GetNFA().Accepts(word));
+		CHECK(DFA.Accepts(word) != 1);
+		CHECK(minimalDFA.Accepts(word) != 1);
+	}
+}
+
+void TestOperators()
+{
+	CheckLanguage("abc", { "abc" }, { "", "ab", "abcc", "acb" });
+	CheckLanguage("a|bc|", { "a", "bc", "" }, { "b", "abc", "aa" });
+	CheckLanguage("a*", { "", "a", "aaaa" }, { "b", "ab" });
+	CheckLanguage("a+", { "a", "aaaa" }, { "", "b", "ab" });
+	CheckLanguage("ab?c", { "ac", "abc" }, { "abbc", "a", "bc" });
+	CheckLanguage("(ab)*", { "", "ab", "abab" }, { "a", "aba", "ba" });
+	CheckLanguage("(a|b)*abb", { "abb", "aabb", "babb", "abababb" }, { "", "ab", "abba", "bb" });
+	CheckLanguage("a(b|c)+d", { "abd", "acbd", "abcbcd" }, { "ad", "abc", "abdd" });
+	// Repetitions apply to what they follow, and apply again to each other.
+	CheckLanguage("ab*", { "a", "abbb" }, { "", "abab" });
+	CheckLanguage("a?*", { "", "a", "aaa" }, { "b" });
+	CheckLanguage("(a+)?", { "", "a", "aa" }, { "b" });
+	CheckLanguage("[abc]x", { "ax", "bx", "cx" }, { "x", "dx", "abx" });
+	CheckLanguage("[a-c0-2]+", { "a", "b2", "c0a1" }, { "", "d", "3" });
+
+	// The textbook example, whose minimal DFA has 4 states.
+	CHECK(Regex("(a|b)*abb").ToDFA().GetStates().size() == 4);
+}
+
+void TestEmptyPattern()
+{
+	CheckLanguage("", { "" }, { "a", " " });
+	CheckLanguage("()", { "" }, { "a" });
+	CheckLanguage("(|a)b", { "b", "ab" }, { "a", "" });
+}
+
+void TestEscapes()
+{
+	CheckLanguage("\\(\\)", { "()" }, { "", "(", ")" });
+	CheckLanguage("a\\|b", { "a|b" }, { "a", "b" });
+	CheckLanguage("\\\\+", { "\\", "\\\\" }, { "" });
+	CheckLanguage("\\?\\+\\[\\]", { "?+[]" }, { "" });
+	CheckLanguage("[\\]\\-x]", { "]", "-", "x" }, { "\\", "" });
+	// A '-' first, last or escaped in a class is itself.
+	CheckLanguage("[-a]", { "-", "a" }, { "b" });
+	CheckLanguage("[a-]", { "-", "a" }, { "b" });
+	CheckLanguage("a-b", { "a-b" }, { "ab" });
+	// A range over '*' leaves it out, since it stands for lambda.
+	CheckLanguage("[\\)-+]", { ")", "+" }, { ",", "(" });
+}
+
+// The column of the error, 0 if the pattern compiles.
+size_t GetErrorColumn(const std::string& pattern)
+{
+	try
+	{
+		Regex regex(pattern);
+	}
+	catch (const ParseError& error)
+	{
+		CHECK(error.GetLine() == 1);
+		return error.GetColumn();
+	}
+	return 0;
+}
+
+void TestSyntaxErrors()
+{
+	// Unbalanced parentheses.
+	CHECK(GetErrorColumn("(ab") == 4);
+	CHECK(GetErrorColumn("a(b|c") == 6);
+	CHECK(GetErrorColumn("((a)") == 5);
+	CHECK(GetErrorColumn("ab)") == 3);
+	CHECK(GetErrorColumn("(a))b") == 4);
+	// A trailing backslash, inside a class or not.
+	CHECK(GetErrorColumn("ab\\") == 4);
+	CHECK(GetErrorColumn("[a\\") == 4);
+	// Repetitions with nothing before them.
+	CHECK(GetErrorColumn("*a") == 1);
+	CHECK(GetErrorColumn("a|+") == 3);
+	CHECK(GetErrorColumn("(?)") == 2);
+	// Classes.
+	CHECK(GetErrorColumn("[]") == 2);
+	CHECK(GetErrorColumn("[ab") == 4);
+	CHECK(GetErrorColumn("[z-a]") == 5);
+	CHECK(GetErrorColumn("[a(]") == 3);
+	// '*' is lambda in the NFA, so it cannot be a symbol even escaped.
+	CHECK(GetErrorColumn("a\\*") == 3);
+
+	CHECK(GetErrorColumn("(a|b)*[a-z]\\)") == 0);
+}
+
+int main()
+{
+	TestOperators();
+	TestEmptyPattern();
+	TestEscapes();
+	TestSyntaxErrors();
+
+	return failures != 0;
+}
@@ -0,0 +1,46 @@
+#include "TestAutomata.h"
+#include "Scanner.h"
+
+// The matches found by running the DFA from every offset, as the scanner defines them.
+std::vector<Scanner::Match> FindAllFromEveryOffset(const CompiledDFA& compiledDFA, const std::string& text)
+{
+	std::vector<Scanner::Match> matches;
+	const char* end = text.data() + text.size();
+	for (const char* first = text.data(); first < end; )
+	{
+		const char* second = compiledDFA.LongestMatch(first, end);
+		if (second)
+		{
+			matches.emplace_back(first - text.data(), second - first);
+			first = second;
+		}
+		else
+			++first;
+	}
+	return matches;
+}
+
+void TestScanner(Random& random, size_t numberOfStates)
+{
+	for (size_t round = 0; round < 50; ++round)
+	{
+		// Sparse final states, so that matches start anywhere and run over each other.
+		DFA DFA = RandomDFA(random, numberOfStates, "abc", 0.7, 0.15);
+		CompiledDFA compiledDFA(DFA);
+		Scanner scanner(compiledDFA);
+		for (size_t index = 0; index < 20; ++index)
+		{
+			std::string text = RandomWord(random, "abcd", 300);
+			CHECK(scanner.FindAll(text.data(), text.size()) == FindAllFromEveryOffset(compiledDFA, text));
+		}
+	}
+}
+
+int main()
+{
+	Random random(4);
+	for (size_t numberOfStates : { 1, 2, 5, 20, 100 })
+		TestScanner(random, numberOfStates);
+
+	return failures != 0;
+}
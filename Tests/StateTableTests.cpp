@@ -0,0 +1,75 @@
+#include "Check.h"
+#include "DFA.h"
+#include "StateTable.h"
+
+void TestStateTable()
+{
+	StateTable stateTable;
+	stateTable.Reserve(4);
+	// Names sharing their first 8 bytes differ only past the stored prefix.
+	CHECK(stateTable.Intern("q") == 0);
+	CHECK(stateTable.Intern("state_long_1") == 1);
+	CHECK(stateTable.Intern("state_long_2") == 2);
+	CHECK(stateTable.Intern("state_lo") == 3);
+	CHECK(stateTable.Intern("state_long_1") == 1);
+	CHECK(stateTable.Find("state_long_2") == 2);
+	CHECK(stateTable.Find("state_long_3") == StateTable::noId);
+	CHECK(stateTable.Find("") == StateTable::noId);
+	CHECK(stateTable.GetSize() == 4);
+
+	// A copy looks names up in its own names.
+	StateTable copy = stateTable;
+	stateTable = StateTable();
+	CHECK(copy.Find("state_lo") == 3);
+	CHECK(copy.GetName(1) == "state_long_1");
+	CHECK(stateTable.GetSize() == 0);
+}
+
+std::vector<StateSet::Id> GetIds(const StateSet& stateSet)
+{
+	return std::vector<StateSet::Id>(stateSet.begin(), stateSet.end());
+}
+
+void TestStateSet()
+{
+	StateSet stateSet;
+	for (StateSet::Id id : { 5, 1, 3, 1, 8, 0 })
+		stateSet.Insert(id);
+	CHECK(GetIds(stateSet) == std::vector<StateSet::Id>({ 5, 1, 3, 8, 0 }));
+
+	CHECK(stateSet.Erase(3));
+	CHECK(!stateSet.Erase(3));
+	CHECK(!stateSet.Erase(100));
+
+	// Ids listed twice and ids not in the set are not counted.
+	CHECK(stateSet.Erase(std::vector<StateSet::Id>({ 8, 5, 8, 100, 3, 5 })) == 2);
+	CHECK(GetIds(stateSet) == std::vector<StateSet::Id>({ 1, 0 }));
+	CHECK(stateSet.size() == 2);
+	CHECK(!stateSet.Contains(8));
+
+	CHECK(stateSet.Erase(std::vector<StateSet::Id>({ 0, 0, 1, 1 })) == 2);
+	CHECK(stateSet.empty());
+	CHECK(stateSet.Insert(8));
+	CHECK(GetIds(stateSet) == std::vector<StateSet::Id>({ 8 }));
+}
+
+void TestRemoveStates()
+{
+	DFA DFA;
+	DFA::StateId q0 = DFA.InsertState("q0"), q1 = DFA.InsertState("q1"), q2 = DFA.InsertState("q2");
+	DFA.InsertFinalState(q1);
+	DFA.InsertFinalState(q2);
+	DFA.RemoveStates({ q1, q1, q2 });
+	CHECK(DFA.GetStates().size() == 1);
+	CHECK(*DFA.GetStates().begin() == q0);
+	CHECK(DFA.GetFinalStates().empty());
+}
+
+int main()
+{
+	TestStateTable();
+	TestStateSet();
+	TestRemoveStates();
+
+	return failures != 0;
+}
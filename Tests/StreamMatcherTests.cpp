@@ -0,0 +1,101 @@
+#include "Check.h"
+#include "StreamMatcher.h"
+
+// a b* c, with a trap state q3 on a leading b: after "abc" the DFA freezes on a missing
+// transition, after "b" it can go on forever without reaching a final state.
+DFA GetDFA()
+{
+	DFA DFA;
+	DFA::StateId q0 = DFA.InsertState("q0"), q1 = DFA.InsertState("q1"), q2 = DFA.InsertState("q2"), q3 = DFA.InsertState("q3");
+	for (const auto& symbol : { 'a', 'b', 'c' })
+	{
+		DFA.InsertSymbol(symbol);
+		DFA.InsertTransition(std::make_pair(q3, symbol), q3);
+	}
+
+	DFA.SetInitialState(q0);
+	DFA.InsertTransition(std::make_pair(q0, 'a'), q1);
+	DFA.InsertTransition(std::make_pair(q0, 'b'), q3);
+	DFA.InsertTransition(std::make_pair(q1, 'b'), q1);
+	DFA.InsertTransition(std::make_pair(q1, 'c'), q2);
+	DFA.InsertFinalState(q2);
+	return DFA;
+}
+
+struct Case
+{
+	std::string input;
+	size_t result;
+	// Where the matcher stops reading: the whole input, or right after the symbol that killed it.
+	uint64_t position;
+};
+
+// The input is fed in the chunks between the given offsets.
+void Feed(StreamMatcher& matcher, const std::string& input, const std::vector<size_t>& splits, const Case& expected)
+{
+	size_t first = 0;
+	for (size_t index = 0; index <= splits.size(); ++index)
+	{
+		size_t second = index < splits.size() ? splits[index] : input.size();
+		bool alive = matcher.Feed(input.data() + first, second - first);
+		// A chunk reports the matcher dead from the one that killed it on.
+		CHECK(alive == (expected.result != StreamMatcher::noContinuation || second < expected.position));
+		first = second;
+	}
+
+	CHECK(matcher.Accepts() == expected.result);
+	CHECK(matcher.GetPosition() == expected.position);
+	CHECK(matcher.IsDead() == (expected.result == StreamMatcher::noContinuation));
+}
+
+void TestSplits(const CompiledDFA& compiledDFA, const Case& expected)
+{
+	const std::string& input = expected.input;
+	StreamMatcher matcher(compiledDFA);
+	for (size_t split1 = 0; split1 <= input.size(); ++split1)
+	{
+		matcher.Reset();
+		Feed(matcher, input, { split1 }, expected);
+
+		for (size_t split2 = split1; split2 <= input.size(); ++split2)
+		{
+			matcher.Reset();
+			Feed(matcher, input, { split1, split2 }, expected);
+		}
+	}
+
+	// One symbol at a time, with empty chunks in between.
+	matcher.Reset();
+	for (const auto& character : input)
+	{
+		matcher.Feed(&character, 1);
+		matcher.Feed("", 0);
+	}
+	CHECK(matcher.Accepts() == expected.result);
+	CHECK(matcher.GetPosition() == expected.position);
+}
+
+int main()
+{
+	CompiledDFA compiledDFA(GetDFA());
+	const size_t dead = StreamMatcher::noContinuation;
+	std::vector<Case> cases = {
+		{ "", 0, 0 },
+		{ "a", 0, 1 },
+		{ "abbbc", 1, 5 },
+		{ "abbbbbbb", 0, 8 },
+		{ "abcab", dead, 4 },
+		{ "abbcc", dead, 5 },
+		{ "bccc", dead, 1 },
+		{ "aabc", dead, 2 },
+	};
+
+	for (const auto& expected : cases)
+	{
+		TestSplits(compiledDFA, expected);
+		if (expected.result != dead)
+			CHECK(compiledDFA.Accepts(expected.input) == expected.result);
+	}
+
+	return failures != 0;
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include "Check.h"
+#include "DFA.h"
+#include "NFA.h"
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+// Random automata and words for the tests that run two implementations of the same thing
+// and compare the results.
+using Random = std::mt19937;
+
+// Every state has each transition with the given probability, so the DFA is usually not
+// complete and has unreachable states.
+inline DFA RandomDFA(Random& random, size_t numberOfStates, const std::string& symbols, double density = 0.8, double finalProbability = 0.3)
+{
+	std::bernoulli_distribution hasTransition(density), isFinal(finalProbability);
+	std::uniform_int_distribution<size_t> anyState(0, numberOfStates - 1);
+
+	DFA DFA;
+	std::vector<DFA::StateId> states;
+	for (size_t index = 0; index < numberOfStates; ++index)
+		states.push_back(DFA.InsertState("q" + std::to_string(index)));
+	for (const auto& symbol : symbols)
+		DFA.InsertSymbol(symbol);
+
+	DFA.SetInitialState(states[0]);
+	for (const auto& state : states)
+	{
+		if (isFinal(random))
+			DFA.InsertFinalState(state);
+		for (const auto& symbol : symbols)
+			if (hasTransition(random))
+				DFA.InsertTransition(std::make_pair(state, symbol), states[anyState(random)]);
+	}
+
+	return DFA;
+}
+
+// Every state has up to maxTargets targets on each symbol, and on lambda if withLambda is set.
+inline NFA RandomNFA(Random& random, size_t numberOfStates, const std::string& symbols, size_t maxTargets = 2, bool withLambda = false,
+	double finalProbability = 0.2)
+{
+	std::bernoulli_distribution isFinal(finalProbability), hasLambda(0.2);
+	std::uniform_int_distribution<size_t> anyState(0, numberOfStates - 1), numberOfTargets(0, maxTargets);
+
+	NFA NFA;
+	std::vector<NFA::StateId> states;
+	for (size_t index = 0; index < numberOfStates; ++index)
+		states.push_back(NFA.InsertState("q" + std::to_string(index)));
+	for (const auto& symbol : symbols)
+		NFA.InsertSymbol(symbol);
+
+	NFA.SetInitialState(states[0]);
+	for (const auto& state : states)
+	{
+		if (isFinal(random))
+			NFA.InsertFinalState(state);
+		for (const auto& symbol : symbols)
+			for (size_t count = numberOfTargets(random); count; --count)
+				NFA.InsertTransition(std::make_pair(state, symbol), states[anyState(random)]);
+		if (withLambda && hasLambda(random))
+			NFA.InsertTransition(std::make_pair(state, NFA::lambda), states[anyState(random)]);
+	}
+
+	return NFA;
+}
+
+inline std::string RandomWord(Random& random, const std::string& symbols, size_t maxLength)
+{
+	std::uniform_int_distribution<size_t> length(0, maxLength), anySymbol(0, symbols.size() - 1);
+	std::string word(length(random), ' ');
+	for (auto& character : word)
+		character = symbols[anySymbol(random)];
+	return word;
+}
+
+// The definition lists every state, transition and final state by name, so two DFAs
+// have the same one only if they are the same automaton, numbered the same way.
+inline std::string GetDefinition(const DFA& DFA)
+{
+	std::ostringstream out;
+	DFA.PrintDefinition(out);
+	return out.str();
+}
+
+// The two DFAs are the same up to the names of their states, and have no unreachable states.
+inline bool AreIsomorphic(const DFA& DFA1, const DFA& DFA2)
+{
+	if (DFA1.GetStates().size() != DFA2.GetStates().size() || DFA1.GetSymbols() != DFA2.GetSymbols())
+		return false;
+
+	std::unordered_map<DFA::StateId, DFA::StateId> images, preimages;
+	std::vector<std::pair<DFA::StateId, DFA::StateId>> queue(1, std::make_pair(DFA1.GetInitialState(), DFA2.GetInitialState()));
+	images[DFA1.GetInitialState()] = DFA2.GetInitialState();
+	preimages[DFA2.GetInitialState()] = DFA1.GetInitialState();
+	for (size_t index = 0; index < queue.size(); ++index)
+	{
+		auto [state1, state2] = queue[index];
+		if (DFA1.GetFinalStates().Contains(state1) != DFA2.GetFinalStates().Contains(state2))
+			return false;
+
+		for (const auto& symbol : DFA1.GetSymbols())
+		{
+			DFA::StateId nextState1 = DFA1.GetTransition(state1, symbol), nextState2 = DFA2.GetTransition(state2, symbol);
+			if ((nextState1 == DFA::noState) != (nextState2 == DFA::noState))
+				return false;
+			if (nextState1 == DFA::noState)
+				continue;
+
+			const auto& image = images.find(nextState1);
+			const auto& preimage = preimages.find(nextState2);
+			if (image == images.end() && preimage == preimages.end())
+			{
+				images[nextState1] = nextState2;
+				preimages[nextState2] = nextState1;
+				queue.emplace_back(nextState1, nextState2);
+			}
+			else if (image == images.end() || preimage == preimages.end() || image->second != nextState2)
+				return false;
+		}
+	}
+
+	return queue.size() == DFA1.GetStates().size();
+}